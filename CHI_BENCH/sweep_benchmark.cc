@@ -0,0 +1,498 @@
+#include "chi_runtime.h"
+
+#include "ChiConsole/chi_console.h"
+#include "ChiPhysics/chi_physics.h"
+#include "ChiMesh/SweepUtilities/SweepScheduler/sweepscheduler.h"
+#include "ChiMesh/SweepUtilities/AngleAggregation/angleaggregation.h"
+#include "ChiMesh/SweepUtilities/AngleSetGroup/anglesetgroup.h"
+
+#include "LinearBoltzmanSolver/lbs_linear_boltzman_solver.h"
+
+#include <chi_mpi.h>
+#include <chi_log.h>
+#include "ChiTimer/chi_timer.h"
+
+extern ChiConsole chi_console;
+extern ChiPhysics chi_physics_handler;
+extern ChiMPI     chi_mpi;
+extern ChiLog     chi_log;
+extern ChiTimer   chi_program_timer;
+
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <map>
+#include <mutex>
+#include <memory>
+
+/**\file sweep_benchmark.cc
+ * Standalone sweep micro-benchmark. Builds an extruded orthogonal mesh
+ * in code, sets up a single groupset and times a number of transport
+ * sweeps, without any source iterations or Krylov solves. The results
+ * (grind time, chunk-overhead ratio and per-angleset chunk times) are
+ * written as JSON by location 0.
+ *
+ * Parameters are given on the command line as name=value pairs, which
+ * are executed as Lua statements before the setup script runs:
+ *
+ * nx,ny,nz        Number of cells in x, y and z. Default 20,20,10.
+ * px,py           Partitions in x and y. px*py must equal the number of
+ *                 processes. Default num_procs x 1.
+ * groups          Number of energy groups. Default 16.
+ * polar,azimuthal Gauss-Legendre-Chebyshev quadrature orders. Default 4,4.
+ * angle_agg       "polar" or "single". Default "polar".
+ * angle_div       Angle aggregation divisions. Default 1.
+ * grp_subsets     Number of group subsets. Default 1.
+ * sweep_threads   Number of sweep threads. Default 1.
+ * level_threads   Number of level-sweep threads. Default 1.
+ * single_psi      Single precision interface psi. Default false.
+ * aggregate       Aggregate downstream messages. Default false.
+ * event_driven    Block instead of polling when idle. Default false.
+ * scheduler       Scheduling algorithm, e.g. SCHEDULER_BOTTOM_LEVEL.
+ *                 Default SCHEDULER_DEPTH_OF_GRAPH.
+ * compare         After the timed sweeps, sweep num_sweeps times with
+ *                 every scheduling algorithm and print the idle time per
+ *                 location. Default false.
+ * num_sweeps      Number of timed sweeps. Default 10.
+ * json            Output file. Default "" which prints to stdout.
+ *
+ * Example: mpiexec -np 4 ChiSweepBench nx=40 ny=40 px=2 py=2 groups=64 \
+ *          'json="sweep.json"'*/
+
+namespace sweep_namespace = chi_mesh::sweep_management;
+typedef sweep_namespace::AngleSet AngleSet;
+typedef sweep_namespace::SchedulingAlgorithm SchedulingAlgorithm;
+
+namespace
+{
+//###################################################################
+/**Setup script. Mesh, materials and solver are created through the
+ * regular Lua API so that the benchmark exercises the same setup path
+ * as an input deck.*/
+const char* bench_setup_script = R"(
+nx = nx or 20; ny = ny or 20; nz = nz or 10
+px = px or chi_number_of_processes; py = py or 1
+groups = groups or 16
+polar = polar or 4; azimuthal = azimuthal or 4
+angle_agg = angle_agg or "polar"
+angle_div = angle_div or 1
+grp_subsets = grp_subsets or 1
+sweep_threads = sweep_threads or 1
+level_threads = level_threads or 1
+single_psi = single_psi or false
+aggregate = aggregate or false
+event_driven = event_driven or false
+scheduler = scheduler or SCHEDULER_DEPTH_OF_GRAPH
+compare = compare or false
+num_sweeps = num_sweeps or 10
+json = json or ""
+
+chiMeshHandlerCreate()
+
+surf_mesh = chiSurfaceMeshCreate()
+chiSurfaceMeshImportFromOBJFile(surf_mesh,bench_obj_file,true)
+
+loops,loop_count = chiSurfaceMeshGetEdgeLoopsPoly(surf_mesh)
+line_meshes = {}
+for k=1,loop_count do
+  split_loops,split_count = chiEdgeLoopSplitByAngle(loops,k-1)
+  for m=1,split_count do
+    line_meshes[#line_meshes+1] = chiLineMeshCreateFromLoop(split_loops,m-1)
+  end
+end
+
+region1 = chiRegionCreate()
+chiRegionAddSurfaceBoundary(region1,surf_mesh)
+for k=1,#line_meshes do
+  chiRegionAddLineBoundary(region1,line_meshes[k])
+end
+
+chiSurfaceMesherCreate(SURFACEMESHER_PREDEFINED)
+chiVolumeMesherCreate(VOLUMEMESHER_EXTRUDER)
+
+chiSurfaceMesherSetProperty(PARTITION_X,px)
+chiSurfaceMesherSetProperty(PARTITION_Y,py)
+for i=1,px-1 do chiSurfaceMesherSetProperty(CUT_X,i/px) end
+for j=1,py-1 do chiSurfaceMesherSetProperty(CUT_Y,j/py) end
+
+chiVolumeMesherSetProperty(EXTRUSION_LAYER,1.0,nz,"Bench")
+chiVolumeMesherSetProperty(PARTITION_Z,1)
+chiVolumeMesherSetProperty(FORCE_POLYGONS,true)
+chiVolumeMesherSetProperty(MESH_GLOBAL,false)
+
+chiSurfaceMesherExecute()
+chiVolumeMesherExecute()
+
+vol0 = chiLogicalVolumeCreate(RPP,-1000,1000,-1000,1000,-1000,1000)
+chiVolumeMesherSetProperty(MATID_FROMLOGICAL,vol0,0)
+
+material = chiPhysicsAddMaterial("Bench Material")
+chiPhysicsMaterialAddProperty(material,TRANSPORT_XSECTIONS)
+chiPhysicsMaterialAddProperty(material,ISOTROPIC_MG_SOURCE)
+chiPhysicsMaterialSetProperty(material,TRANSPORT_XSECTIONS,
+                              SIMPLEXS1,groups,1.0,0.5)
+src = {}
+for g=1,groups do src[g] = 1.0 end
+chiPhysicsMaterialSetProperty(material,ISOTROPIC_MG_SOURCE,FROM_ARRAY,src)
+
+phys1 = chiLBSCreateSolver()
+chiSolverAddRegion(phys1,region1)
+for g=1,groups do chiLBSCreateGroup(phys1) end
+
+pquad = chiCreateProductQuadrature(GAUSS_LEGENDRE_CHEBYSHEV,azimuthal,polar)
+
+gs0 = chiLBSCreateGroupset(phys1)
+chiLBSGroupsetAddGroups(phys1,gs0,0,groups-1)
+chiLBSGroupsetSetQuadrature(phys1,gs0,pquad)
+if (angle_agg == "single") then
+  chiLBSGroupsetSetAngleAggregationType(phys1,gs0,LBSGroupset.ANGLE_AGG_SINGLE)
+else
+  chiLBSGroupsetSetAngleAggregationType(phys1,gs0,LBSGroupset.ANGLE_AGG_POLAR)
+end
+chiLBSGroupsetSetAngleAggDiv(phys1,gs0,angle_div)
+chiLBSGroupsetSetGroupSubsets(phys1,gs0,grp_subsets)
+chiLBSGroupsetSetSinglePrecisionPsi(phys1,gs0,single_psi)
+
+chiLBSSetProperty(phys1,SWEEP_NUM_THREADS,sweep_threads)
+chiLBSSetProperty(phys1,SWEEP_LEVEL_THREADS,level_threads)
+chiLBSSetProperty(phys1,SWEEP_AGGREGATE_MESSAGES,aggregate)
+chiLBSSetProperty(phys1,SWEEP_EVENT_DRIVEN,event_driven)
+chiLBSSetProperty(phys1,SWEEP_SCHEDULER,scheduler)
+chiLBSSetProperty(phys1,PARTITION_METHOD,FROM_SURFACE)
+chiLBSSetProperty(phys1,DISCRETIZATION_METHOD,PWLD3D)
+
+chiLBSInitialize(phys1)
+)";
+
+//###################################################################
+/**Writes a unit square made of nx x ny quads as an OBJ file.*/
+void WriteSurfaceOBJ(const std::string& file_name, int nx, int ny)
+{
+  std::ofstream file(file_name);
+  if (not file.is_open())
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "SweepBenchmark: Could not open " << file_name << " for writing.";
+    exit(EXIT_FAILURE);
+  }
+
+  file << "# Sweep benchmark surface\n";
+  file << std::setprecision(16);
+  for (int j=0; j<=ny; j++)
+    for (int i=0; i<=nx; i++)
+      file << "v " << double(i)/nx << " " << double(j)/ny << " 0.0\n";
+
+  file << "vn 0.0 0.0 1.0\n";
+
+  auto vid = [nx](int i, int j) {return j*(nx+1) + i + 1;};
+  for (int j=0; j<ny; j++)
+    for (int i=0; i<nx; i++)
+      file << "f "
+           << vid(i  ,j  ) << "//1 "
+           << vid(i+1,j  ) << "//1 "
+           << vid(i+1,j+1) << "//1 "
+           << vid(i  ,j+1) << "//1\n";
+}
+
+//###################################################################
+/**Reads a numeric Lua global.*/
+double GetLuaNumber(const char* name)
+{
+  lua_State* L = chi_console.consoleState;
+  lua_getglobal(L, name);
+  double value = lua_tonumber(L, -1);
+  lua_pop(L, 1);
+  return value;
+}
+
+//###################################################################
+/**Reads a string Lua global.*/
+std::string GetLuaString(const char* name)
+{
+  lua_State* L = chi_console.consoleState;
+  lua_getglobal(L, name);
+  const char* value = lua_tostring(L, -1);
+  std::string result = (value == nullptr) ? std::string() : value;
+  lua_pop(L, 1);
+  return result;
+}
+
+//###################################################################
+/**Reads a boolean Lua global.*/
+bool GetLuaBool(const char* name)
+{
+  lua_State* L = chi_console.consoleState;
+  lua_getglobal(L, name);
+  bool value = lua_toboolean(L, -1);
+  lua_pop(L, 1);
+  return value;
+}
+
+//###################################################################
+/**Chunk decorator accumulating the execution time of every angle set.
+ * Worker copies decorate worker copies of the wrapped chunk and share
+ * the timing table, so threaded sweeps are timed as well.*/
+class TimedSweepChunk : public sweep_namespace::SweepChunk
+{
+public:
+  struct AngleSetTiming
+  {
+    size_t num_calls  = 0;
+    double total_time = 0.0;
+  };
+
+  struct TimingTable
+  {
+    std::mutex                          mutex;
+    std::map<AngleSet*,AngleSetTiming>  timings;
+  };
+
+private:
+  sweep_namespace::SweepChunk* chunk;
+  bool                         owns_chunk;
+  std::shared_ptr<TimingTable> table;
+
+public:
+  TimedSweepChunk(sweep_namespace::SweepChunk* in_chunk,
+                  bool in_owns_chunk,
+                  std::shared_ptr<TimingTable> in_table) :
+    chunk(in_chunk),
+    owns_chunk(in_owns_chunk),
+    table(std::move(in_table))
+  {
+    x = chunk->x;
+    suppress_surface_src = chunk->suppress_surface_src;
+  }
+
+  ~TimedSweepChunk() override
+  {
+    if (owns_chunk) delete chunk;
+  }
+
+  void Sweep(AngleSet* angle_set) override
+  {
+    chunk->SetDestinationPhi(x);
+    chunk->suppress_surface_src = suppress_surface_src;
+
+    double t0 = chi_program_timer.GetTime();
+    chunk->Sweep(angle_set);
+    double t1 = chi_program_timer.GetTime();
+
+    std::lock_guard<std::mutex> lock(table->mutex);
+    AngleSetTiming& timing = table->timings[angle_set];
+    timing.num_calls  += 1;
+    timing.total_time += (t1-t0)/1000.0;
+  }
+
+  SweepChunk* CreateWorkerCopy() override
+  {
+    SweepChunk* worker_chunk = chunk->CreateWorkerCopy();
+    if (worker_chunk == nullptr) return nullptr;
+    return new TimedSweepChunk(worker_chunk,true,table);
+  }
+};
+}//namespace
+
+//###################################################################
+/**Benchmark entry point.*/
+int main(int argc, char** argv)
+{
+  ChiTechInitialize(argc,argv);
+
+  //================================================== Synthetic surface
+  int nx = static_cast<int>(GetLuaNumber("nx"));
+  int ny = static_cast<int>(GetLuaNumber("ny"));
+  if (nx <= 0) nx = 20;
+  if (ny <= 0) ny = 20;
+
+  const std::string obj_file_name = "SweepBench_surface.obj";
+  if (chi_mpi.location_id == 0)
+    WriteSurfaceOBJ(obj_file_name, nx, ny);
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  lua_pushstring(chi_console.consoleState, obj_file_name.c_str());
+  lua_setglobal(chi_console.consoleState, "bench_obj_file");
+
+  //================================================== Setup through Lua
+  if (luaL_dostring(chi_console.consoleState, bench_setup_script) != 0)
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "SweepBenchmark: Setup failed. "
+      << lua_tostring(chi_console.consoleState, -1);
+    exit(EXIT_FAILURE);
+  }
+
+  const int px = static_cast<int>(GetLuaNumber("px"));
+  const int py = static_cast<int>(GetLuaNumber("py"));
+  if (px*py != chi_mpi.process_count)
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "SweepBenchmark: px*py=" << px*py
+      << " does not match the number of processes "
+      << chi_mpi.process_count << ".";
+    exit(EXIT_FAILURE);
+  }
+
+  const int num_sweeps = std::max(1,static_cast<int>(GetLuaNumber("num_sweeps")));
+  const std::string json_file_name = GetLuaString("json");
+
+  int solver_index = static_cast<int>(GetLuaNumber("phys1"));
+  auto solver = dynamic_cast<LinearBoltzman::Solver*>(
+    chi_physics_handler.solver_stack[solver_index]);
+
+  //================================================== Groupset setup
+  const int gs = 0;
+  LBSGroupset* groupset = solver->group_sets[gs];
+  groupset->BuildDiscMomOperator(solver->options.scattering_order);
+  groupset->BuildMomDiscOperator(solver->options.scattering_order);
+  groupset->BuildSubsets();
+
+  double t_setup0 = chi_program_timer.GetTime();
+  solver->ComputeSweepOrderings(groupset);
+  solver->InitFluxDataStructures(groupset);
+  double t_setup1 = chi_program_timer.GetTime();
+
+  solver->SetSource(gs,LinearBoltzman::SourceFlags::USE_MATERIAL_SOURCE,
+                       LinearBoltzman::SourceFlags::SUPPRESS_PHI_OLD);
+
+  auto timing_table = std::make_shared<TimedSweepChunk::TimingTable>();
+  SweepChunk* lbs_chunk = solver->SetSweepChunk(gs);
+  lbs_chunk->SetDestinationPhi(&solver->phi_new_local);
+  TimedSweepChunk sweep_chunk(lbs_chunk,false,timing_table);
+
+  //================================================== Warm-up sweep
+  {
+    MainSweepScheduler warmup_scheduler(
+      static_cast<SchedulingAlgorithm>(solver->options.sweep_scheduler),
+      groupset->angle_agg);
+    warmup_scheduler.SetNumberOfThreads(solver->options.sweep_num_threads);
+    if (solver->options.sweep_aggregate_messages)
+      warmup_scheduler.SetMessageAggregation(&solver->comm_set);
+    warmup_scheduler.SetEventDriven(solver->options.sweep_event_driven);
+    solver->phi_new_local.assign(solver->phi_new_local.size(),0.0);
+    warmup_scheduler.Sweep(&sweep_chunk);
+  }
+  timing_table->timings.clear();
+
+  //================================================== Timed sweeps
+  MainSweepScheduler sweep_scheduler(
+    static_cast<SchedulingAlgorithm>(solver->options.sweep_scheduler),
+    groupset->angle_agg);
+  sweep_scheduler.SetNumberOfThreads(solver->options.sweep_num_threads);
+  if (solver->options.sweep_aggregate_messages)
+    sweep_scheduler.SetMessageAggregation(&solver->comm_set);
+  sweep_scheduler.SetEventDriven(solver->options.sweep_event_driven);
+
+  MPI_Barrier(MPI_COMM_WORLD);
+  for (int s=0; s<num_sweeps; s++)
+  {
+    solver->phi_new_local.assign(solver->phi_new_local.size(),0.0);
+    sweep_scheduler.Sweep(&sweep_chunk);
+  }
+
+  //================================================== Reduce timings
+  double local_sweep_time = sweep_scheduler.GetAverageSweepTime();
+  double local_overhead   = 1.0 - sweep_scheduler.GetAngleSetTimings()[2];
+  double local_setup_time = (t_setup1 - t_setup0)/1000.0;
+
+  double max_sweep_time = 0.0, max_overhead = 0.0, max_setup_time = 0.0;
+  MPI_Reduce(&local_sweep_time,&max_sweep_time,1,MPI_DOUBLE,MPI_MAX,0,
+             MPI_COMM_WORLD);
+  MPI_Reduce(&local_overhead,&max_overhead,1,MPI_DOUBLE,MPI_MAX,0,
+             MPI_COMM_WORLD);
+  MPI_Reduce(&local_setup_time,&max_setup_time,1,MPI_DOUBLE,MPI_MAX,0,
+             MPI_COMM_WORLD);
+
+  //Angle sets are ordered identically on all locations
+  std::vector<int>    as_group, as_set, as_angles, as_grps;
+  std::vector<double> as_local_time;
+  auto angle_agg = groupset->angle_agg;
+  for (int asg=0; asg<angle_agg->angle_set_groups.size(); asg++)
+  {
+    auto& angle_sets = angle_agg->angle_set_groups[asg]->angle_sets;
+    for (int as=0; as<angle_sets.size(); as++)
+    {
+      as_group.push_back(asg);
+      as_set.push_back(as);
+      as_angles.push_back(angle_sets[as]->angles.size());
+      as_grps.push_back(angle_sets[as]->GetNumGrps());
+      as_local_time.push_back(
+        timing_table->timings[angle_sets[as]].total_time/num_sweeps);
+    }
+  }
+  std::vector<double> as_max_time(as_local_time.size(),0.0);
+  MPI_Reduce(as_local_time.data(),as_max_time.data(),
+             static_cast<int>(as_local_time.size()),MPI_DOUBLE,MPI_MAX,0,
+             MPI_COMM_WORLD);
+
+  //================================================== Report
+  if (chi_mpi.location_id == 0)
+  {
+    size_t num_angles = groupset->quadrature->abscissae.size();
+    long int num_unknowns = (long int)solver->glob_dof_count*
+                            (long int)num_angles*
+                            (long int)groupset->groups.size();
+    double grind_time = max_sweep_time*1.0e9*chi_mpi.process_count/
+                        num_unknowns;
+
+    std::stringstream json;
+    json << std::setprecision(8);
+    json << "{\n";
+    json << "  \"num_procs\": " << chi_mpi.process_count << ",\n";
+    json << "  \"mesh\": {\"nx\": " << nx << ", \"ny\": " << ny
+         << ", \"nz\": " << static_cast<int>(GetLuaNumber("nz"))
+         << ", \"px\": " << px << ", \"py\": " << py << "},\n";
+    json << "  \"num_groups\": " << groupset->groups.size() << ",\n";
+    json << "  \"num_angles\": " << num_angles << ",\n";
+    json << "  \"angle_agg\": \"" << GetLuaString("angle_agg") << "\",\n";
+    json << "  \"angle_div\": " << static_cast<int>(GetLuaNumber("angle_div"))
+         << ",\n";
+    json << "  \"grp_subsets\": " << groupset->grp_subsets.size() << ",\n";
+    json << "  \"sweep_threads\": " << solver->options.sweep_num_threads
+         << ",\n";
+    json << "  \"aggregate_messages\": "
+         << (solver->options.sweep_aggregate_messages? "true" : "false")
+         << ",\n";
+    json << "  \"event_driven\": "
+         << (solver->options.sweep_event_driven? "true" : "false")
+         << ",\n";
+    json << "  \"scheduler\": " << solver->options.sweep_scheduler << ",\n";
+    json << "  \"num_sweeps\": " << num_sweeps << ",\n";
+    json << "  \"num_unknowns\": " << num_unknowns << ",\n";
+    json << "  \"setup_time_s\": " << max_setup_time << ",\n";
+    json << "  \"sweep_time_s\": " << max_sweep_time << ",\n";
+    json << "  \"grind_time_ns\": " << grind_time << ",\n";
+    json << "  \"chunk_overhead_ratio\": " << max_overhead << ",\n";
+    json << "  \"angle_sets\": [";
+    for (size_t k=0; k<as_max_time.size(); k++)
+    {
+      json << ((k == 0) ? "\n" : ",\n");
+      json << "    {\"angle_set_group\": " << as_group[k]
+           << ", \"angle_set\": " << as_set[k]
+           << ", \"num_angles\": " << as_angles[k]
+           << ", \"num_groups\": " << as_grps[k]
+           << ", \"chunk_time_s\": " << as_max_time[k] << "}";
+    }
+    json << "\n  ]\n}\n";
+
+    if (json_file_name.empty())
+      std::cout << json.str();
+    else
+    {
+      std::ofstream file(json_file_name);
+      file << json.str();
+    }
+  }
+
+  //================================================== Scheduler comparison
+  if (GetLuaBool("compare"))
+    sweep_scheduler.CompareSchedulingAlgorithms(&sweep_chunk,num_sweeps);
+
+  delete lbs_chunk;
+  solver->ResetSweepOrderings(groupset);
+  solver->ClearSweepStructures();
+
+  ChiTechFinalize();
+
+  return 0;
+}
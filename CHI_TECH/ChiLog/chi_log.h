@@ -2,6 +2,7 @@
 #define _chi_log_h
 
 #include "chi_logstream.h"
+#include "chi_tracer.h"
 #include <vector>
 #include <memory>
 
@@ -193,6 +194,14 @@ std::cout << chi_log.PrintEventHistory(tag);
 [0]      3.813121000 SINGLE_OCCURRENCE B
 [0]      3.813122000 SINGLE_OCCURRENCE C
 \endverbatim
+ *
+ * ## Part C: Tracing
+ * Repeating events keep every event for the whole run and are too costly
+ * for events that occur millions of times, such as angle set executions.
+ * For these ChiLog::tracer, a ChiTracer, records compact binary records
+ * into a fixed-size ring buffer. Tracing is switched on and off at runtime,
+ * from lua with `chiLogTraceEnable(capacity)` and `chiLogTraceDisable()`,
+ * and the records are exported with `chiLogTraceExport(file_name)`.
  * */
 class ChiLog
 {
@@ -200,6 +209,9 @@ private:
   DummyStream dummy_stream;
   int verbosity;
 
+public:
+  ChiTracer   tracer;
+
 public:
   //00
                   ChiLog() noexcept;
@@ -0,0 +1,193 @@
+#include "chi_tracer.h"
+#include <chi_mpi.h>
+
+extern ChiMPI chi_mpi;
+
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+
+//###################################################################
+/**Default constructor. The tracer starts disabled without storage.*/
+ChiTracer::ChiTracer() noexcept :
+  mask(0),
+  head(0),
+  enabled(false),
+  origin(std::chrono::steady_clock::now())
+{}
+
+//###################################################################
+/**Returns the id of the named event, registering it if needed.*/
+size_t ChiTracer::RegisterEvent(const std::string& event_name)
+{
+  for (size_t e=0; e<event_names.size(); e++)
+    if (event_names[e] == event_name) return e;
+
+  event_names.push_back(event_name);
+  return event_names.size()-1;
+}
+
+//###################################################################
+/**Allocates a ring buffer of at least the given number of records,
+ * rounded up to a power of two, clears it and enables tracing.
+ *
+ * Collective. The time origin is reset right after a barrier such that
+ * the timelines of all locations line up in the merged export, up to
+ * the barrier's release skew.*/
+void ChiTracer::Enable(size_t capacity)
+{
+  enabled.store(false);
+
+  size_t size = 1;
+  while (size < capacity) size <<= 1;
+
+  records.assign(size, Record());
+  mask = size - 1;
+  head.store(0);
+
+  MPI_Barrier(MPI_COMM_WORLD);
+  origin = std::chrono::steady_clock::now();
+
+  enabled.store(true);
+}
+
+//###################################################################
+/**Disables tracing. The stored records remain available for export.*/
+void ChiTracer::Disable()
+{
+  enabled.store(false);
+}
+
+//###################################################################
+/**Discards all stored records.*/
+void ChiTracer::Clear()
+{
+  head.store(0);
+}
+
+//###################################################################
+/**Returns the number of records currently stored.*/
+size_t ChiTracer::NumStoredRecords() const
+{
+  uint64_t num_written = head.load();
+  return (num_written < records.size())? num_written : records.size();
+}
+
+//###################################################################
+/**Returns a small index for the calling thread.*/
+uint8_t ChiTracer::ThreadIndex()
+{
+  static std::atomic<uint8_t> thread_counter(0);
+  thread_local uint8_t thread_index = thread_counter.fetch_add(1);
+
+  return thread_index;
+}
+
+//###################################################################
+/**Returns the stored records from oldest to newest.*/
+std::vector<ChiTracer::Record> ChiTracer::GetOrderedRecords() const
+{
+  std::vector<Record> ordered;
+
+  uint64_t num_written = head.load();
+  uint64_t num_stored  = NumStoredRecords();
+  ordered.reserve(num_stored);
+  for (uint64_t i=num_written-num_stored; i<num_written; i++)
+    ordered.push_back(records[i & mask]);
+
+  return ordered;
+}
+
+//###################################################################
+/**Gathers the records of all locations on location 0 and writes them
+ * in the Chrome trace event format. Must be called by all locations.*/
+void ChiTracer::ExportChromeTrace(const std::string& file_name)
+{
+  std::vector<Record> local_records = GetOrderedRecords();
+
+  //============================================= Gather records
+  int local_bytes = local_records.size()*sizeof(Record);
+  std::vector<int> recv_bytes(chi_mpi.process_count,0);
+  MPI_Gather(&local_bytes, 1, MPI_INT,
+             recv_bytes.data(), 1, MPI_INT, 0, MPI_COMM_WORLD);
+
+  std::vector<int> displacements(chi_mpi.process_count,0);
+  int total_bytes = 0;
+  for (int loc=0; loc<chi_mpi.process_count; loc++)
+  {
+    displacements[loc] = total_bytes;
+    total_bytes += recv_bytes[loc];
+  }
+
+  std::vector<Record> all_records;
+  if (chi_mpi.location_id == 0)
+    all_records.resize(total_bytes/sizeof(Record));
+
+  MPI_Gatherv(local_records.data(), local_bytes, MPI_BYTE,
+              all_records.data(), recv_bytes.data(), displacements.data(),
+              MPI_BYTE, 0, MPI_COMM_WORLD);
+
+  if (chi_mpi.location_id != 0) return;
+
+  //============================================= Write json
+  std::ofstream ofile(file_name);
+  ofile << std::fixed << std::setprecision(3);
+  ofile << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+
+  const char* phase_codes[] = {"B","E","i"};
+  size_t r = 0;
+  for (int loc=0; loc<chi_mpi.process_count; loc++)
+  {
+    size_t num_loc_records = recv_bytes[loc]/sizeof(Record);
+    for (size_t k=0; k<num_loc_records; k++, r++)
+    {
+      const Record& record = all_records[r];
+
+      bool known_event = (record.event_id >= 0) and
+                         (static_cast<size_t>(record.event_id) <
+                          event_names.size());
+      std::string name = (known_event)?
+                         event_names[record.event_id] :
+                         std::to_string(record.event_id);
+
+      ofile << ((r == 0)? "\n" : ",\n");
+      ofile << "{\"name\":\"" << name << "\""
+            << ",\"ph\":\"" << phase_codes[record.phase] << "\""
+            << ",\"ts\":" << record.time_ns*1.0e-3
+            << ",\"pid\":" << loc
+            << ",\"tid\":" << static_cast<int>(record.thread);
+      if (record.phase == static_cast<uint8_t>(Phase::INSTANT))
+        ofile << ",\"s\":\"t\"";
+      ofile << ",\"args\":{\"angle_set\":" << record.angle_set
+            << ",\"location\":" << record.location << "}}";
+    }
+  }
+  ofile << "\n]}\n";
+  ofile.close();
+}
+
+//###################################################################
+/**Writes the records of this location to the binary file
+ * file_base.<location>.bin. The file holds the number of event names,
+ * the null terminated names, the number of records and the raw
+ * records.*/
+void ChiTracer::ExportBinary(const std::string& file_base)
+{
+  std::vector<Record> local_records = GetOrderedRecords();
+
+  std::string file_name =
+    file_base + "." + std::to_string(chi_mpi.location_id) + ".bin";
+
+  std::ofstream ofile(file_name, std::ios::binary);
+
+  uint64_t num_names = event_names.size();
+  ofile.write((char*)&num_names, sizeof(uint64_t));
+  for (const auto& name : event_names)
+    ofile.write(name.c_str(), name.size()+1);
+
+  uint64_t num_records = local_records.size();
+  ofile.write((char*)&num_records, sizeof(uint64_t));
+  ofile.write((char*)local_records.data(), num_records*sizeof(Record));
+
+  ofile.close();
+}
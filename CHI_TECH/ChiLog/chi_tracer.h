@@ -0,0 +1,108 @@
+#ifndef _chi_tracer_h
+#define _chi_tracer_h
+
+#include <vector>
+#include <string>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+//###################################################################
+/**Low overhead event tracer. Records are compact binary structures
+ * written into a fixed-size ring buffer, once the buffer is full the
+ * oldest records are overwritten. Writing a record is lock-free and
+ * can be done from any thread: a slot is claimed with an atomic
+ * increment and filled in place. When tracing is disabled a call to
+ * Trace costs a single relaxed atomic load.
+ *
+ * Event ids are obtained once with RegisterEvent, ideally in the same
+ * order on all locations since the exported names are those of
+ * location 0.
+ *
+ * \code
+ * size_t ev_id = chi_log.tracer.RegisterEvent("AngleSetExecute");
+ *
+ * chi_log.tracer.Enable(1<<20);
+ * chi_log.tracer.Trace(ev_id, ChiTracer::Phase::BEGIN, angle_set_num);
+ * ...
+ * chi_log.tracer.Trace(ev_id, ChiTracer::Phase::END, angle_set_num);
+ *
+ * chi_log.tracer.ExportChromeTrace("sweep_trace.json"); //Collective
+ * \endcode
+ *
+ * The Chrome trace can be opened with chrome://tracing or
+ * ui.perfetto.dev. Every location is shown as a process and every
+ * thread as a thread of that process.
+ *
+ * Enable and the exports are collective. Enable, Disable, Clear and
+ * the exports must not be called while other threads are tracing.*/
+class ChiTracer
+{
+public:
+  enum class Phase : uint8_t
+  {
+    BEGIN   = 0,  ///< Begin of a duration
+    END     = 1,  ///< End of a duration
+    INSTANT = 2   ///< Single occurrence
+  };
+
+  /**A single trace record. 24 bytes.*/
+  struct Record
+  {
+    int64_t  time_ns;   ///< Nanoseconds since Enable
+    int32_t  event_id;  ///< Id from RegisterEvent
+    int32_t  angle_set; ///< Angle set number or -1
+    int32_t  location;  ///< Peer location or -1
+    uint8_t  phase;     ///< Phase
+    uint8_t  thread;    ///< Thread index
+    uint16_t reserved;
+  };
+
+private:
+  std::vector<Record>      records;
+  uint64_t                 mask;
+  std::atomic<uint64_t>    head;
+  std::atomic<bool>        enabled;
+  std::vector<std::string> event_names;
+  std::chrono::steady_clock::time_point origin;
+
+public:
+  //00
+  ChiTracer() noexcept;
+
+  size_t RegisterEvent(const std::string& event_name);
+  void   Enable(size_t capacity);
+  void   Disable();
+  void   Clear();
+  bool   IsEnabled() const {return enabled.load(std::memory_order_relaxed);}
+  size_t NumStoredRecords() const;
+
+  //###################################################################
+  /**Records an event if tracing is enabled.*/
+  void Trace(size_t event_id, Phase phase,
+             int angle_set = -1, int location = -1)
+  {
+    if (not enabled.load(std::memory_order_relaxed)) return;
+
+    uint64_t slot = head.fetch_add(1, std::memory_order_relaxed);
+    Record& record   = records[slot & mask];
+    record.time_ns   = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                         std::chrono::steady_clock::now() - origin).count();
+    record.event_id  = static_cast<int32_t>(event_id);
+    record.angle_set = angle_set;
+    record.location  = location;
+    record.phase     = static_cast<uint8_t>(phase);
+    record.thread    = ThreadIndex();
+    record.reserved  = 0;
+  }
+
+  //01
+  void ExportChromeTrace(const std::string& file_name);
+  void ExportBinary(const std::string& file_base);
+
+private:
+  static uint8_t ThreadIndex();
+  std::vector<Record> GetOrderedRecords() const;
+};
+
+#endif
@@ -82,4 +82,79 @@ int chiLog(lua_State* L)
   chi_log.Log((LOG_LVL)mode) << message;
 
   return 0;
-}
\ No newline at end of file
+}
+//###################################################################
+/**Enables the low overhead event tracer. Any previously stored records
+ * are discarded. Must be called on all locations, the time origin of
+ * the records is synchronized with a barrier.
+
+\param Capacity int Number of records held by the ring buffer. Rounded up
+ to a power of two. Each record uses 24 bytes. [default:1048576]
+
+\ingroup LuaLogging
+*/
+int chiLogTraceEnable(lua_State* L)
+{
+  int num_args = lua_gettop(L);
+
+  size_t capacity = 1 << 20;
+  if (num_args >= 1)
+  {
+    int value = lua_tonumber(L,1);
+    if (value < 1)
+    {
+      chi_log.Log(LOG_ALLERROR)
+        << "chiLogTraceEnable: Capacity must be at least 1.";
+      exit(EXIT_FAILURE);
+    }
+    capacity = value;
+  }
+
+  chi_log.tracer.Enable(capacity);
+
+  return 0;
+}
+
+//###################################################################
+/**Disables the event tracer. Stored records remain available for
+ * export.
+
+\ingroup LuaLogging
+*/
+int chiLogTraceDisable(lua_State* L)
+{
+  chi_log.tracer.Disable();
+
+  return 0;
+}
+
+//###################################################################
+/**Exports the traced records. Must be called on all locations.
+
+\param FileName char Output file name.
+\param Binary bool Optional. If true, each location writes its raw records
+ to FileName.<location>.bin. Otherwise location 0 writes a Chrome trace
+ json file of all locations, viewable with chrome://tracing or
+ ui.perfetto.dev. [default:false]
+
+\ingroup LuaLogging
+*/
+int chiLogTraceExport(lua_State* L)
+{
+  int num_args = lua_gettop(L);
+
+  if (num_args < 1)
+    LuaPostArgAmountError("chiLogTraceExport",1,num_args);
+
+  const char* file_name = lua_tostring(L,1);
+  bool binary = false;
+  if (num_args >= 2)
+    binary = lua_toboolean(L,2);
+
+  if (binary)
+    chi_log.tracer.ExportBinary(file_name);
+  else
+    chi_log.tracer.ExportChromeTrace(file_name);
+
+  return 0;
+}
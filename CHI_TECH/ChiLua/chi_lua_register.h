@@ -136,6 +136,9 @@ RegisterFunction(chiMPIBarrier)
 //module:Logging Utilities
 RegisterFunction(chiLogSetVerbosity)
 RegisterFunction(chiLog)
+RegisterFunction(chiLogTraceEnable)
+RegisterFunction(chiLogTraceDisable)
+RegisterFunction(chiLogTraceExport)
 RegisterConstant(LOG_0,          1);
 RegisterConstant(LOG_0WARNING,   2);
 RegisterConstant(LOG_0ERROR,     3);
@@ -5,23 +5,19 @@
 #include "../ChiMesh/chi_mesh.h"
 
 //################################################################### Class def
-/**Simple implementation a communicator set.*/
+/**Communicator used for sweep communication. All messages between
+ * locations go over a single distributed-graph communicator, built from
+ * the neighbors of each location only, and are told apart by their tags.
+ * Ranks are not reordered, i.e. the rank of a location in the
+ * communicator is its location id.*/
 class ChiMPICommunicatorSet
 {
 public:
-  std::vector<MPI_Comm>  communicators;
-  std::vector<MPI_Group> location_groups;
-  MPI_Group              world_group;
+  MPI_Comm         comm = MPI_COMM_NULL;
+  std::vector<int> neighbor_locations;
 
 public:
-  int MapIonJ(int locI, int locJ)
-  {
-    int group_rank;
-    MPI_Group_translate_ranks(world_group,1,&locI,
-                              location_groups[locJ],&group_rank);
-
-    return group_rank;
-  }
+  void Initialize(const std::vector<int>& in_neighbor_locations);
 };
 
 //################################################################### Class def
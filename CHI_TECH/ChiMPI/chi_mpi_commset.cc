@@ -0,0 +1,26 @@
+#include "chi_mpi.h"
+
+//###################################################################
+/**Creates the neighborhood communicator. Every location only supplies
+ * its own neighbors, hence the setup scales with the number of
+ * neighbors rather than with the number of locations. Collective over
+ * MPI_COMM_WORLD.*/
+void ChiMPICommunicatorSet::
+  Initialize(const std::vector<int>& in_neighbor_locations)
+{
+  neighbor_locations = in_neighbor_locations;
+
+  if (comm != MPI_COMM_NULL)
+    MPI_Comm_free(&comm);
+
+  const int num_neighbors = neighbor_locations.size();
+
+  MPI_Dist_graph_create_adjacent(MPI_COMM_WORLD,
+                                 num_neighbors,neighbor_locations.data(),
+                                 MPI_UNWEIGHTED,
+                                 num_neighbors,neighbor_locations.data(),
+                                 MPI_UNWEIGHTED,
+                                 MPI_INFO_NULL,
+                                 0, //reorder
+                                 &comm);
+}
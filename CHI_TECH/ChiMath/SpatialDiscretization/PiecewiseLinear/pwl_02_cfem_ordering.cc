@@ -8,17 +8,33 @@
 extern ChiLog chi_log;
 extern ChiMPI chi_mpi;
 
+#include <map>
+#include <algorithm>
+
 //###################################################################
 /**Reorders the nodes for parallel computation in a Continuous
- * Finite Element calculation.*/
+ * Finite Element calculation.
+ *
+ * The nodes of local cells are split into exclusive nodes and shared
+ * nodes, the latter lying on faces shared with cells of another
+ * location. A shared node is owned by the lowest location sharing it.
+ * Locations only know the locations they share faces with, so the
+ * owner is found by exchanging owner candidates with the neighboring
+ * locations until no candidate changes. The owned nodes of a location
+ * (exclusive nodes first, then owned shared nodes) are numbered
+ * contiguously from an offset obtained with MPI_Exscan, and the new
+ * indices of shared nodes owned by other locations are again obtained
+ * by neighbor exchanges.
+ *
+ * Only the nodes of local cells are mapped.*/
 std::pair<int,int> SpatialDiscretization_PWL::
   OrderNodesCFEM(chi_mesh::MeshContinuum *grid)
 {
-  ChiTimer t_stage[6];
+  ChiTimer t_stage[4];
 
   t_stage[0].Reset();
 
-  //================================================== Get SET of local
+  //================================================== Get sorted local
   //                                                   exclusive + non-exclusive
   //                                                   nodes
   std::set<int> exnonex_nodes_set;
@@ -30,377 +46,218 @@ std::pair<int,int> SpatialDiscretization_PWL::
       exnonex_nodes_set.insert(vid);
   }
 
-  //================================================== Copy set into vector
-  std::vector<int> exnonex_nodes;
-  for (auto& vid : exnonex_nodes_set)
-    exnonex_nodes.push_back(vid);
-  chi_log.Log(LOG_0VERBOSE_1) << "*** Reordering stage 0 time: "
-                              << t_stage[0].GetTime()/1000.0;
+  std::vector<int> exnonex_nodes(exnonex_nodes_set.begin(),
+                                 exnonex_nodes_set.end());
+  const int num_local_nodes = exnonex_nodes.size();
 
-  t_stage[1].Reset();
-  //================================================== Initialize ghost flags
-  std::vector<bool> ghost_flags;
-  ghost_flags.resize(exnonex_nodes.size(),false);
-
-
-  //================================================== Determine ghost flags
-  //Run through each cell and for each local nodes deterime
-  //if the nodes are ghosts to another location
+  auto LocalNodeIndex = [&exnonex_nodes](int vid)
+  {
+    return (int)std::distance(exnonex_nodes.begin(),
+                              std::lower_bound(exnonex_nodes.begin(),
+                                               exnonex_nodes.end(),
+                                               vid));
+  };
+
+  //================================================== Find shared nodes
+  //Run through each cell and for each face shared with another
+  //location register its nodes as shared with that location.
+  std::map<int,std::set<int>> locJ_shared_set;
   for (auto& cell_glob_index : grid->local_cell_glob_indices)
   {
     auto cell = grid->cells[cell_glob_index];
 
-    for (size_t f=0; f < cell->faces.size(); f++)
+    for (auto& face : cell->faces)
     {
-      if (cell->faces[f].neighbor >= 0)
-      {
-        int adj_cell_ind = cell->faces[f].neighbor;
-        auto adj_cell = grid->cells[adj_cell_ind];
+      if (face.neighbor < 0) continue;
 
-        if (adj_cell->partition_id != cell->partition_id)
-        {
-          for (auto v_index : cell->faces[f].vertex_ids)
-          {
-            int v_setind =
-              (int)std::distance(exnonex_nodes.begin(),
-                                 std::find(std::begin(exnonex_nodes),
-                                           std::end(exnonex_nodes),
-                                           v_index));
-            ghost_flags[v_setind] = true;
-          }//for face verts
-        }//if neighbor not local
-      }//if neighbor is not a boundary
+      auto adj_cell = grid->cells[face.neighbor];
+      if (adj_cell->partition_id == cell->partition_id) continue;
+
+      auto& shared_set = locJ_shared_set[adj_cell->partition_id];
+      for (auto v_index : face.vertex_ids)
+        shared_set.insert(LocalNodeIndex(v_index));
     }//for cell face
   }
-  chi_log.Log(LOG_0VERBOSE_1) << "*** Reordering stage 1 time: "
-                              << t_stage[1].GetTime()/1000.0;
 
-  t_stage[2].Reset();
-  //================================================== Develop vectors of exclusive
-  //                                                   and non-exclusive nodes
-  // Basically splitting exnonex_nodes into exclusive
-  // and non-exclusive nodes
-  std::vector<int> exclusive_nodes;
-  std::vector<int> nonexclus_nodes;
-  for (size_t i=0; i<exnonex_nodes.size(); i++)
+  //Both sides of an interface register the same nodes, hence the
+  //sorted lists of local node indices are aligned across the interface.
+  std::vector<int>              neighbor_locs;
+  std::vector<std::vector<int>> neighbor_shared_nodes;
+  std::vector<bool>             ghost_flags(num_local_nodes,false);
+  for (auto& locJ_shared : locJ_shared_set)
   {
-    int ind = exnonex_nodes[i];
-    if (ghost_flags[i])
-      nonexclus_nodes.push_back(ind);
-    else
-      exclusive_nodes.push_back(ind);
+    neighbor_locs.push_back(locJ_shared.first);
+    neighbor_shared_nodes.emplace_back(locJ_shared.second.begin(),
+                                       locJ_shared.second.end());
+    for (int n : locJ_shared.second)
+      ghost_flags[n] = true;
   }
+  const size_t num_neighbors = neighbor_locs.size();
 
-  chi_log.Log(LOG_ALLVERBOSE_1) << "Number of exclusive nodes = "
-                                << exclusive_nodes.size()
-                                << " and ghost nodes = "
-                                << nonexclus_nodes.size();
-  chi_log.Log(LOG_0VERBOSE_1) << "*** Reordering stage 2 time: "
-                              << t_stage[2].GetTime()/1000.0;
-
-  t_stage[3].Reset();
-  //================================================== Ring communicate ghost nodes
-  //Using ring communication we communicate the ghost
-  //nodes to find a single list of all the ghost nodes
-  std::vector<int> global_ghost_nodes;
+  chi_log.Log(LOG_0VERBOSE_1) << "*** Reordering stage 0 time: "
+                              << t_stage[0].GetTime()/1000.0;
 
-  //=================================== Location 0 sends to location 1
-  if (chi_mpi.location_id==0)
-  {
-    MPI_Send(nonexclus_nodes.data(),
-             nonexclus_nodes.size(),
-             MPI_INT,1,123,MPI_COMM_WORLD);
-  }
-  //=================================== Location n=1..(N-1) first receives
-  //                                    n-1
-  else
+  //================================================== Neighbor exchange
+  //Sends the values of the shared nodes to every neighbor and returns
+  //the values received for the same nodes.
+  std::vector<std::vector<int>> send_buffers(num_neighbors);
+  std::vector<std::vector<int>> recv_buffers(num_neighbors);
+  std::vector<MPI_Request>      requests(2*num_neighbors);
+  auto ExchangeSharedValues = [&](const std::vector<int>& values, int tag)
   {
-    std::vector<int> upstream_nonex;
-
-    MPI_Status status;
-    MPI_Probe(chi_mpi.location_id-1,123,MPI_COMM_WORLD,&status);
-    int num_to_recv=0;
-    MPI_Get_count(&status,MPI_INT,&num_to_recv);
-    upstream_nonex.resize(num_to_recv,-1);
-    MPI_Recv(upstream_nonex.data(),num_to_recv,
-             MPI_INT,chi_mpi.location_id-1,123,
-             MPI_COMM_WORLD,MPI_STATUS_IGNORE);
-
-    //============================ Run through location n non-exclusive nodes
-    // if a non-exclusive node is not in the upstream list then
-    // it gets added to the list
-    //for (size_t i=0; i<nonexclus_nodes.size(); i++)
-    for (auto& node : nonexclus_nodes)
+    for (size_t p=0; p<num_neighbors; p++)
     {
-      if (std::find(upstream_nonex.begin(),
-                    upstream_nonex.end(),
-                    node) == upstream_nonex.end())
-        upstream_nonex.push_back(node);
-    }
+      const auto& shared_nodes = neighbor_shared_nodes[p];
 
-    //============================ If this location is not the last location
-    // send the updated upstream_nonex to location n+1
-    if (chi_mpi.location_id<(chi_mpi.process_count-1))
-    {
-      MPI_Send(upstream_nonex.data(),upstream_nonex.size(),
-               MPI_INT,chi_mpi.location_id+1,123,MPI_COMM_WORLD);
-    }
-    //============================ On the last location send the completed
-    // upstream_nonex back to all other locations
-    else
-    {
-      chi_log.Log(LOG_ALLVERBOSE_1)
-        << "Total number of ghost nodes after collect: "
-        << upstream_nonex.size();
-      std::copy(upstream_nonex.begin(),upstream_nonex.end(),std::back_inserter(global_ghost_nodes));
-      for (int loc=0; loc<(chi_mpi.process_count-1); loc++)
-      {
-        MPI_Send(global_ghost_nodes.data(),global_ghost_nodes.size(),
-                 MPI_INT,loc,124,MPI_COMM_WORLD);
-      }
+      send_buffers[p].clear();
+      for (int n : shared_nodes)
+        send_buffers[p].push_back(values[n]);
+      recv_buffers[p].assign(shared_nodes.size(),-1);
 
+      MPI_Irecv(recv_buffers[p].data(),recv_buffers[p].size(),MPI_INT,
+                neighbor_locs[p],tag,MPI_COMM_WORLD,&requests[2*p]);
+      MPI_Isend(send_buffers[p].data(),send_buffers[p].size(),MPI_INT,
+                neighbor_locs[p],tag,MPI_COMM_WORLD,&requests[2*p+1]);
     }
-  }
-
+    MPI_Waitall(requests.size(),requests.data(),MPI_STATUSES_IGNORE);
+  };
 
-
-  //================================================== Collect ghost nodes
-  if (chi_mpi.location_id<(chi_mpi.process_count-1))
+  //Values travel at least one location per round
+  auto CheckExchangeRounds = [](int round)
   {
-    MPI_Status status;
-    MPI_Probe(chi_mpi.process_count-1,124,MPI_COMM_WORLD,&status);
-    int num_to_recv=0;
-    MPI_Get_count(&status,MPI_INT,&num_to_recv);
-    global_ghost_nodes.resize(num_to_recv,-1);
-    MPI_Recv(global_ghost_nodes.data(),num_to_recv,
-             MPI_INT,chi_mpi.process_count-1,124,
-             MPI_COMM_WORLD,MPI_STATUS_IGNORE);
-  }
-
-
-
-  chi_log.Log(LOG_ALLVERBOSE_1) << "Total number of ghost nodes: "
-                                << global_ghost_nodes.size() << std::endl;
-  MPI_Barrier(MPI_COMM_WORLD);
-
-  chi_log.Log(LOG_0VERBOSE_1) << "*** Reordering stage 3 time: "
-                              << t_stage[3].GetTime()/1000.0;
+    if (round > chi_mpi.process_count)
+    {
+      chi_log.Log(LOG_ALLERROR)
+        << "SpatialDiscretization_PWL::OrderNodesCFEM: Shared node "
+           "ordering did not converge.";
+      exit(EXIT_FAILURE);
+    }
+  };
 
-  t_stage[3].Reset();
-  //================================================== Seperate ghost nodes into
-  //                                                   pieces
-  // Imagine that each location is a cell in a 1D array.
-  // The interfaces between each cell is where the ghost nodes are
-  // and therefore each cell needs to take ownership of the some ghost nodes.
-  // Now the ghost nodes to the left of an interior cell is the same
-  // as the ghost nodes to the right of cell i-1. One approach is then
-  // to split these interface ghost nodes in half and give each cell
-  // half of them. Therefore we split each interface in half and assign
-  // the ghost node-halfs to cells on either side of the interface.
-  // With N amount of "cells" there would be N-1 interfaces and therefore
-  // 2(N-1) halfs of the ghost nodes.
-  int g_piece = 0;
-  if (chi_mpi.process_count>1)
+  t_stage[1].Reset();
+  //================================================== Determine owners
+  //Every round each location lowers its owner candidates to the lowest
+  //candidate of its neighbors.
+  std::vector<int> node_owner(num_local_nodes,chi_mpi.location_id);
+  for (int round=0; ; round++)
   {
-    g_piece = (int)floor(global_ghost_nodes.size()/
-                         (2*(chi_mpi.process_count-1)));
-  }
+    CheckExchangeRounds(round);
+    ExchangeSharedValues(node_owner,123);
 
-  int g_from = 0;
-  int g_to = 0;
-  if (chi_mpi.location_id==0)
-  {
-    g_from = 0;
-    g_to = g_piece-1;
-  }
-  else if (chi_mpi.location_id < (chi_mpi.process_count-1))
-  {
-    g_from = g_piece-1 + 2*g_piece*(chi_mpi.location_id-1)+1;
-    g_to   = g_from + 2*g_piece-1;
-  } else
-  {
-    g_from = g_piece-1 + 2*g_piece*(chi_mpi.location_id-1)+1;
-    g_to   = (int)global_ghost_nodes.size()-1;
-  }
-  int num_g_loc = (g_to - g_from +1);
-  chi_log.Log(LOG_ALLVERBOSE_1) << "Local ghost ownership: "
-                                << g_from << "->" << g_to
-                                << "(" << num_g_loc << ")" << std::endl;
-  MPI_Barrier(MPI_COMM_WORLD);
+    int local_changed = 0;
+    for (size_t p=0; p<num_neighbors; p++)
+      for (size_t k=0; k<neighbor_shared_nodes[p].size(); k++)
+      {
+        int n = neighbor_shared_nodes[p][k];
+        if (recv_buffers[p][k] < node_owner[n])
+        {
+          node_owner[n] = recv_buffers[p][k];
+          local_changed = 1;
+        }
+      }
 
-  //================================================== Ring Compute local portion
-  //The local portion of the nodes are the exclusive nodes
-  //plus the locally owned ghost nodes
-  //The list of exclusive nodes will be packed into
-  //a parallel array according it ownership. Lets say
-  //each location n has ownership of the parallel vectors starting
-  //at x_ni. x_0i should obviously be x_0i=0. Now, location n has ownership
-  //from x_ni to x_nf where we still have to determine x_f. Somewhere between
-  //x_ni and x_nf there would be x_n_local (the point where the exclusive nodes
-  //ends and where we need to pack the portion of the ghost nodes that location
-  // n took ownership of as determined by the previous step.
-  int local_from = 0;
-  int local_to = 0;
-  if (chi_mpi.location_id==0)
-  {
-    local_from = 0;
-    local_to = (int)exclusive_nodes.size() - 1 + num_g_loc;
-    //world.send(chi_mpi.location_id+1,125,local_to);
-    MPI_Send(&local_to,1,
-             MPI_INT,chi_mpi.location_id+1,125,MPI_COMM_WORLD);
+    int changed = 0;
+    MPI_Allreduce(&local_changed,&changed,1,MPI_INT,MPI_MAX,MPI_COMM_WORLD);
+    if (changed == 0) break;
   }
-  else
-  {
-    int upstream_loc_end = 0;
-    MPI_Recv(&upstream_loc_end,1,
-             MPI_INT,chi_mpi.location_id-1,125,
-             MPI_COMM_WORLD,MPI_STATUS_IGNORE);
 
-    local_from = upstream_loc_end + 1;
-    local_to = local_from + (int)exclusive_nodes.size() - 1 + num_g_loc;
-
-    if (chi_mpi.location_id<(chi_mpi.process_count-1))
-    {
-      MPI_Send(&local_to,1,
-               MPI_INT,chi_mpi.location_id+1,125,MPI_COMM_WORLD);
-    }
-
-  }
-  int tot_local_nodes = local_to - local_from + 1;
-  chi_log.Log(LOG_ALLVERBOSE_1) << "Local node ownership "
-                                << local_from << "->" << local_to
-                                << "(" << tot_local_nodes << ")"
-                                << std::endl;
-  MPI_Barrier(MPI_COMM_WORLD);
-  chi_log.Log(LOG_0VERBOSE_1) << "*** Reordering stage 4 time: "
-                              << t_stage[4].GetTime()/1000.0;
-  MPI_Barrier(MPI_COMM_WORLD);
-
-  t_stage[5].Reset();
-
-
-  //================================================== Ring map the ghost nodes
-  // We still have a list of global_ghost_nodes that needs mapping but
-  // fortunately we know which portions of this we own [g_from to g_to].
-  // We can now compute a mapping of the ghost nodes to where they will be
-  // placed in the global array. The mapping will not be complete yet
-  // since it is still based on the ghost node index in the vector
-  // global_ghost_nodes.
-  std::vector<int> ghost_mapping;
-  ghost_mapping.resize(global_ghost_nodes.size(),-1);
-  if (chi_mpi.location_id==0)
-  {
-    for (int g=g_from; g<= g_to; g++)
-    {
-      int ghost_index = local_from + (int)exclusive_nodes.size() + g-g_from;
-      ghost_mapping[g] = ghost_index;
-    }
-    MPI_Send(ghost_mapping.data(),ghost_mapping.size(),
-             MPI_INT,chi_mpi.location_id+1,126,MPI_COMM_WORLD);
-  }
-  else
+  //================================================== Develop vectors of exclusive
+  //                                                   and owned shared nodes
+  std::vector<int> exclusive_nodes;
+  std::vector<int> owned_ghost_nodes;
+  int num_ghost_nodes = 0;
+  for (int n=0; n<num_local_nodes; n++)
   {
-    std::vector<int> upstream_ghost_mapping;
-    //world.recv(chi_mpi.location_id-1,126,upstream_ghost_mapping);
-    MPI_Status status;
-    MPI_Probe(chi_mpi.location_id-1,126,MPI_COMM_WORLD,&status);
-    int num_to_recv=0;
-    MPI_Get_count(&status,MPI_INT,&num_to_recv);
-    upstream_ghost_mapping.resize(num_to_recv,-1);
-    MPI_Recv(upstream_ghost_mapping.data(),num_to_recv,
-             MPI_INT,chi_mpi.location_id-1,126,
-             MPI_COMM_WORLD,MPI_STATUS_IGNORE);
-
-    std::copy(upstream_ghost_mapping.begin(),
-              upstream_ghost_mapping.end(),
-              ghost_mapping.begin());
-    for (int g=g_from; g<= g_to; g++)
-    {
-      int ghost_index = local_from + (int)exclusive_nodes.size() + g-g_from;
-      ghost_mapping[g] = ghost_index;
-    }
-    if (chi_mpi.location_id<(chi_mpi.process_count-1))
-    {
-      MPI_Send(ghost_mapping.data(),ghost_mapping.size(),
-               MPI_INT,chi_mpi.location_id+1,126,MPI_COMM_WORLD);
-    }
+    if (not ghost_flags[n])
+      exclusive_nodes.push_back(n);
     else
     {
-      for (int loc=0; loc<(chi_mpi.process_count-1); loc++)
-      {
-        //world.send(loc,127,ghost_mapping);//
-        MPI_Send(ghost_mapping.data(),ghost_mapping.size(),
-                 MPI_INT,loc,127,MPI_COMM_WORLD);
-      }
+      ++num_ghost_nodes;
+      if (node_owner[n] == chi_mpi.location_id)
+        owned_ghost_nodes.push_back(n);
     }
   }
 
-  //================================================== Collect ghost mapping
-  //                                                   from last location
-  if (chi_mpi.location_id<(chi_mpi.process_count-1))
-  {
-//    world.recv(chi_mpi.process_count-1,127,ghost_mapping);
-    MPI_Status status;
-    MPI_Probe(chi_mpi.process_count-1,127,MPI_COMM_WORLD,&status);
-    int num_to_recv=0;
-    MPI_Get_count(&status,MPI_INT,&num_to_recv);
-    ghost_mapping.resize(num_to_recv,-1);
-    MPI_Recv(ghost_mapping.data(),num_to_recv,
-             MPI_INT,chi_mpi.process_count-1,127,
-             MPI_COMM_WORLD,MPI_STATUS_IGNORE);
-  }
+  chi_log.Log(LOG_ALLVERBOSE_1) << "Number of exclusive nodes = "
+                                << exclusive_nodes.size()
+                                << " and ghost nodes = "
+                                << num_ghost_nodes
+                                << " (owned " << owned_ghost_nodes.size()
+                                << ")";
+  chi_log.Log(LOG_0VERBOSE_1) << "*** Reordering stage 1 time: "
+                              << t_stage[1].GetTime()/1000.0;
 
+  t_stage[2].Reset();
+  //================================================== Compute local portion
+  //The local portion of the nodes are the exclusive nodes
+  //plus the owned ghost nodes. The portions are stacked in location
+  //order.
+  int num_owned = exclusive_nodes.size() + owned_ghost_nodes.size();
+  int local_from = 0;
+  MPI_Exscan(&num_owned,&local_from,1,MPI_INT,MPI_SUM,MPI_COMM_WORLD);
+  if (chi_mpi.location_id == 0) local_from = 0;
+  int local_to = local_from + num_owned - 1;
 
-  //================================================== Initialize forward
-  //                                                   ordering
-  //Initially this is just pass through
-  std::vector<int> node_ordering;
-  int num_nodes = grid->nodes.size();
-  node_ordering.resize(num_nodes,-1);
+  chi_log.Log(LOG_ALLVERBOSE_1) << "Local node ownership "
+                                << local_from << "->" << local_to
+                                << "(" << num_owned << ")";
 
+  std::vector<int> node_ordering_local(num_local_nodes,-1);
+  int new_index = local_from;
+  for (int n : exclusive_nodes)
+    node_ordering_local[n] = new_index++;
+  for (int n : owned_ghost_nodes)
+    node_ordering_local[n] = new_index++;
 
-  //================================================== Creating mapping of
-  //                                                   exclusive nodes
-  int num_exl = exclusive_nodes.size();
-  for (int n=0; n<num_exl; n++)
+  chi_log.Log(LOG_0VERBOSE_1) << "*** Reordering stage 2 time: "
+                              << t_stage[2].GetTime()/1000.0;
+
+  t_stage[3].Reset();
+  //================================================== Map ghost nodes owned
+  //                                                   elsewhere
+  //Known indices are passed on to neighbors until every shared node
+  //is mapped. The owner is normally a direct neighbor, in which case a
+  //single round suffices.
+  for (int round=0; ; round++)
   {
-    int orig_index = exclusive_nodes[n];
-    node_ordering[orig_index] = local_from + n;
-  }
+    CheckExchangeRounds(round);
+    ExchangeSharedValues(node_ordering_local,124);
 
+    for (size_t p=0; p<num_neighbors; p++)
+      for (size_t k=0; k<neighbor_shared_nodes[p].size(); k++)
+      {
+        int n = neighbor_shared_nodes[p][k];
+        if (node_ordering_local[n] < 0)
+          node_ordering_local[n] = recv_buffers[p][k];
+      }
 
-  //================================================== Create mapping of ghost
-  //                                                   nodes
-  for (size_t n=0; n<global_ghost_nodes.size(); n++)
-  {
-    int orig_index = global_ghost_nodes[n];
-    node_ordering[orig_index] = ghost_mapping[n];
-  }
+    int local_unmapped = 0;
+    for (int mapping : node_ordering_local)
+      if (mapping < 0) {local_unmapped = 1; break;}
 
-  chi_log.Log(LOG_0VERBOSE_1) << "*** Reordering stage 5 time: "
-                              << t_stage[5].GetTime()/1000.0;
-  MPI_Barrier(MPI_COMM_WORLD);
+    int unmapped = 0;
+    MPI_Allreduce(&local_unmapped,&unmapped,1,MPI_INT,MPI_MAX,MPI_COMM_WORLD);
+    if (unmapped == 0) break;
+  }
 
+  chi_log.Log(LOG_0VERBOSE_1) << "*** Reordering stage 3 time: "
+                              << t_stage[3].GetTime()/1000.0;
 
   //================================================== Push up these mappings
   //                                                   to the mesher
+  int num_nodes = grid->nodes.size();
   node_mapping.clear();
   reverse_node_mapping.clear();
-  node_mapping.reserve(num_nodes);
+  node_mapping.resize(num_nodes,-1);
   reverse_node_mapping.resize(num_nodes,-1);
-  int temp;
-  for (int i=0; i<num_nodes; i++)
+  for (int n=0; n<num_local_nodes; n++)
   {
-    node_mapping.push_back(node_ordering[i]);
-    temp = node_ordering[i];
+    int orig_index = exnonex_nodes[n];
+    int mapped_index = node_ordering_local[n];
 
-    if (temp>=0)
-      reverse_node_mapping[node_ordering[i]] = i;
+    node_mapping[orig_index] = mapped_index;
+    reverse_node_mapping[mapped_index] = orig_index;
   }
 
-  chi_log.Log(LOG_0VERBOSE_1) << "*** Reordering stages complete time: "
-                              << t_stage[5].GetTime()/1000.0;
-  MPI_Barrier(MPI_COMM_WORLD);
-
   return {local_from,local_to};
-}
\ No newline at end of file
+}
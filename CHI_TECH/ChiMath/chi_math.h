@@ -71,5 +71,8 @@ namespace chi_math
                         VecDbl& e_vec, int max_it = 2000, double tol = 1.0e-13);
 }
 
+#include "chi_math_batched.h"
+#include "chi_math_gemm.h"
+
 
 #endif
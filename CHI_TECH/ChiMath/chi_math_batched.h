@@ -0,0 +1,105 @@
+#ifndef CHI_MATH_BATCHED_H
+#define CHI_MATH_BATCHED_H
+
+#if defined(__AVX512F__) || defined(__AVX2__) || defined(__AVX__)
+#include <immintrin.h>
+#endif
+
+//###################################################################
+/**\file chi_math_batched.h
+ * Kernels that operate on a batch of nb independent small dense systems
+ * of the same dimension. The systems are interleaved so that entry (i,j)
+ * of system s is stored at A[(i*n+j)*nb + s] and entry i of the
+ * right-hand side at b[i*nb + s]. The innermost loops then run over the
+ * batch, which maps the systems onto SIMD lanes. AVX-512 or AVX2 is used
+ * when the compiler targets it, otherwise a scalar loop is used.*/
+
+namespace chi_math
+{
+namespace batched
+{
+  //######################################################### y -= a*x
+  /** Lane-wise y[s] -= a[s]*x[s] for s in [0,nb).*/
+  inline void SubMul(double* __restrict__ y,
+                     const double* __restrict__ a,
+                     const double* __restrict__ x, const int nb)
+  {
+    int s=0;
+#if defined(__AVX512F__)
+    for (; s+8<=nb; s+=8)
+      _mm512_storeu_pd(y+s,
+        _mm512_fnmadd_pd(_mm512_loadu_pd(a+s),_mm512_loadu_pd(x+s),
+                         _mm512_loadu_pd(y+s)));
+#elif defined(__AVX2__) && defined(__FMA__)
+    for (; s+4<=nb; s+=4)
+      _mm256_storeu_pd(y+s,
+        _mm256_fnmadd_pd(_mm256_loadu_pd(a+s),_mm256_loadu_pd(x+s),
+                         _mm256_loadu_pd(y+s)));
+#elif defined(__AVX__)
+    for (; s+4<=nb; s+=4)
+      _mm256_storeu_pd(y+s,
+        _mm256_sub_pd(_mm256_loadu_pd(y+s),
+                      _mm256_mul_pd(_mm256_loadu_pd(a+s),
+                                    _mm256_loadu_pd(x+s))));
+#endif
+    for (; s<nb; ++s)
+      y[s] -= a[s]*x[s];
+  }
+
+  //######################################################### y = a/x
+  /** Lane-wise y[s] = a[s]/x[s] for s in [0,nb). y may alias a.*/
+  inline void Div(double* y, const double* a,
+                  const double* __restrict__ x, const int nb)
+  {
+    int s=0;
+#if defined(__AVX512F__)
+    for (; s+8<=nb; s+=8)
+      _mm512_storeu_pd(y+s,
+        _mm512_div_pd(_mm512_loadu_pd(a+s),_mm512_loadu_pd(x+s)));
+#elif defined(__AVX__)
+    for (; s+4<=nb; s+=4)
+      _mm256_storeu_pd(y+s,
+        _mm256_div_pd(_mm256_loadu_pd(a+s),_mm256_loadu_pd(x+s)));
+#endif
+    for (; s<nb; ++s)
+      y[s] = a[s]/x[s];
+  }
+
+  //######################################################### Gauss Elimination
+  /** Gauss Elimination without pivoting on nb interleaved row-major nxn
+   * systems. The solutions are returned in b. The scratch array must hold
+   * at least nb values. If N>0, n is ignored.*/
+  template<int N>
+  inline void GaussElimination(double* A, double* b, double* scratch,
+                               const int nb, int n=N)
+  {
+    const int nn = (N > 0)? N : n;
+    double* val = scratch;
+
+    // Forward elimination
+    for (int i = 0; i < nn-1; ++i)
+    {
+      const double* aii = &A[(i*nn+i)*nb];
+      const double* bi  = &b[i*nb];
+      for (int j = i+1; j < nn; ++j)
+      {
+        Div(val,&A[(j*nn+i)*nb],aii,nb);
+        SubMul(&b[j*nb],val,bi,nb);
+        for (int k = i+1; k < nn; ++k)
+          SubMul(&A[(j*nn+k)*nb],val,&A[(i*nn+k)*nb],nb);
+      }
+    }
+
+    // Back substitution
+    for (int i = nn-1; i >= 0; --i)
+    {
+      double* bi = &b[i*nb];
+      for (int j = i+1; j < nn; ++j)
+        SubMul(bi,&A[(i*nn+j)*nb],&b[j*nb],nb);
+      Div(bi,bi,&A[(i*nn+i)*nb],nb);
+    }
+  }
+}
+}
+
+#endif
@@ -0,0 +1,79 @@
+#ifndef CHI_MATH_GEMM_H
+#define CHI_MATH_GEMM_H
+
+#include <algorithm>
+
+//###################################################################
+/**\file chi_math_gemm.h
+ * Blocked dense matrix-matrix product on flat row-major arrays, meant
+ * for the small products that occur per cell (e.g. moment-to-discrete
+ * operators applied to all the dofs and groups of a cell). The K and N
+ * dimensions are blocked so that the panel of B stays in cache, and four
+ * rows of C are updated per pass over a row of B so that every loaded
+ * value of B is used four times. The innermost loop runs over contiguous
+ * columns and is left to the compiler to vectorize.*/
+
+namespace chi_math
+{
+  //######################################################### C += A*B
+  /** Computes C += A*B where A is MxK, B is KxN and C is MxN, all
+   * row-major with leading dimensions lda, ldb and ldc.*/
+  inline void MatMulAdd(const int M, const int N, const int K,
+                        const double* A, const int lda,
+                        const double* B, const int ldb,
+                        double* C, const int ldc)
+  {
+    constexpr int NC = 512;
+    constexpr int KC = 128;
+
+    for (int jj=0; jj<N; jj+=NC)
+    {
+      const int nc = std::min(NC,N-jj);
+      for (int kk=0; kk<K; kk+=KC)
+      {
+        const int kc = std::min(KC,K-kk);
+
+        //========================================= Four rows at a time
+        int i=0;
+        for (; i+4<=M; i+=4)
+        {
+          double* __restrict__ c0 = &C[(i  )*ldc+jj];
+          double* __restrict__ c1 = &C[(i+1)*ldc+jj];
+          double* __restrict__ c2 = &C[(i+2)*ldc+jj];
+          double* __restrict__ c3 = &C[(i+3)*ldc+jj];
+          for (int k=kk; k<kk+kc; ++k)
+          {
+            const double a0 = A[(i  )*lda+k];
+            const double a1 = A[(i+1)*lda+k];
+            const double a2 = A[(i+2)*lda+k];
+            const double a3 = A[(i+3)*lda+k];
+            const double* __restrict__ bk = &B[k*ldb+jj];
+            for (int j=0; j<nc; ++j)
+            {
+              const double bkj = bk[j];
+              c0[j] += a0*bkj;
+              c1[j] += a1*bkj;
+              c2[j] += a2*bkj;
+              c3[j] += a3*bkj;
+            }
+          }
+        }
+
+        //========================================= Remaining rows
+        for (; i<M; ++i)
+        {
+          double* __restrict__ ci = &C[i*ldc+jj];
+          for (int k=kk; k<kk+kc; ++k)
+          {
+            const double aik = A[i*lda+k];
+            const double* __restrict__ bk = &B[k*ldb+jj];
+            for (int j=0; j<nc; ++j)
+              ci[j] += aik*bk[j];
+          }
+        }
+      }//for kk
+    }//for jj
+  }
+}
+
+#endif
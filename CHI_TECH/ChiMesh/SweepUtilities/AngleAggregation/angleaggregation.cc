@@ -12,6 +12,8 @@ extern ChiMPI chi_mpi;
  * intra-location or inter-location cyclic interfaces. */
 double chi_mesh::sweep_management::AngleAggregation::GetDelayedPsiNorm()
 {
+  CompleteDelayedData();
+
   double loc_ret_val = 0.0;
 
   for (auto angsetgrp : angle_set_groups)
@@ -33,6 +35,8 @@ double chi_mesh::sweep_management::AngleAggregation::GetDelayedPsiNorm()
 /** Resets all the intra-location and inter-location cyclic interfaces.*/
 void chi_mesh::sweep_management::AngleAggregation::ResetDelayedPsi()
 {
+  CompleteDelayedData();
+
   for (auto angsetgrp : angle_set_groups)
     for (auto angset : angsetgrp->angle_sets)
       for (auto& delayed_data : angset->delayed_prelocI_outgoing_psi)
@@ -43,6 +47,20 @@ void chi_mesh::sweep_management::AngleAggregation::ResetDelayedPsi()
       angset->delayed_local_psi.assign(angset->delayed_local_psi.size(),0.0);
 }
 
+//###################################################################
+/** Completes the delayed data of the last sweep on all angle sets.
+ * Sweeps leave the delayed data pending, this must be called before
+ * the delayed psi is accessed outside of a sweep.*/
+void chi_mesh::sweep_management::AngleAggregation::CompleteDelayedData()
+{
+  for (size_t q=0; q<angle_set_groups.size(); q++)
+  {
+    auto& angle_sets = angle_set_groups[q]->angle_sets;
+    for (size_t as=0; as<angle_sets.size(); as++)
+      angle_sets[as]->ReceiveDelayedData(as + q*angle_sets.size());
+  }
+}
+
 //###################################################################
 /** Initializes reflecting boundary conditions. */
 void chi_mesh::sweep_management::AngleAggregation::InitializeReflectingBCs()
@@ -245,6 +263,8 @@ std::pair<int,int> chi_mesh::sweep_management::AngleAggregation::
 void chi_mesh::sweep_management::AngleAggregation::
   AssembleAngularUnknowns(int &index, double* x_ref)
 {
+  CompleteDelayedData();
+
   //======================================== Opposing reflecting bndries
   for (auto bndry : sim_boundaries)
   {
@@ -282,6 +302,8 @@ void chi_mesh::sweep_management::AngleAggregation::
 void chi_mesh::sweep_management::AngleAggregation::
 DisassembleAngularUnknowns(int &index, const double* x_ref)
 {
+  CompleteDelayedData();
+
   //======================================== Opposing reflecting bndries
   for (auto bndry : sim_boundaries)
   {
@@ -42,6 +42,7 @@ public:
 public:
   double GetDelayedPsiNorm();
   void   ResetDelayedPsi();
+  void   CompleteDelayedData();
 
   void InitializeReflectingBCs();
   void ResetReflectingBCs();
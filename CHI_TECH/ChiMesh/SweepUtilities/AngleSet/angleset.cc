@@ -17,7 +17,8 @@ AngleSet(int in_numgrps,
          std::vector<int>& angle_indices,
          std::vector<SweepBndry*>& sim_boundaries,
          int sweep_eager_limit,
-         ChiMPICommunicatorSet* in_comm_set):
+         ChiMPICommunicatorSet* in_comm_set,
+         bool in_single_precision_psi):
   sweep_buffer(this,sweep_eager_limit,in_comm_set),
   ref_boundaries(sim_boundaries)
 {
@@ -25,6 +26,7 @@ AngleSet(int in_numgrps,
   spds     = in_spds;
   executed = false;
   ref_subset = in_ref_subset;
+  single_precision_psi = in_single_precision_psi;
   std::copy(angle_indices.begin(),
             angle_indices.end(),
             std::back_inserter(angles));
@@ -50,7 +52,8 @@ AngleSet(int in_numgrps,
          std::vector<int>& angle_indices,
          std::vector<SweepBndry*>& sim_boundaries,
          int sweep_eager_limit,
-         ChiMPICommunicatorSet* in_comm_set):
+         ChiMPICommunicatorSet* in_comm_set,
+         bool in_single_precision_psi):
   sweep_buffer(this,sweep_eager_limit,in_comm_set),
   ref_boundaries(sim_boundaries)
 {
@@ -58,6 +61,7 @@ AngleSet(int in_numgrps,
   spds     = in_spds;
   executed = false;
   ref_subset = in_ref_subset;
+  single_precision_psi = in_single_precision_psi;
   std::copy(angle_indices.begin(),
             angle_indices.end(),
             std::back_inserter(angles));
@@ -108,27 +112,47 @@ AngleSetAdvance(chi_mesh::sweep_management::SweepChunk *sweep_chunk,
   else if (status == Status::READY_TO_EXECUTE and
            permission == ExecutionPermission::EXECUTE)
   {
-    sweep_buffer.InitializeLocalAndDownstreamBuffers();
+    PrepareForExecution();
 
     chi_log.LogEvent(timing_tags[0],ChiLog::EventType::EVENT_BEGIN);
     sweep_chunk->Sweep(this); //Execute chunk
     chi_log.LogEvent(timing_tags[0],ChiLog::EventType::EVENT_END);
 
-    //Send outgoing psi and clear local and receive buffers
-    sweep_buffer.SendDownstreamPsi(angle_set_num);
-    sweep_buffer.ClearLocalAndReceiveBuffers();
+    CompleteExecution(angle_set_num);
 
-    //Update boundary readiness
-    for (auto bndry : ref_boundaries)
-      bndry->UpdateAnglesReadyStatus(angles,ref_subset);
-
-    executed = true;
     return AngleSetStatus::FINISHED;
   }
   else
     return AngleSetStatus::READY_TO_EXECUTE;
 }
 
+//###################################################################
+/**Allocates the local and downstream buffers of an angle set whose
+ * upstream data has been received. After this call the sweep chunk
+ * can be executed on the angle set, possibly by another thread.*/
+void chi_mesh::sweep_management::AngleSet::PrepareForExecution()
+{
+  sweep_buffer.InitializeLocalAndDownstreamBuffers();
+}
+
+//###################################################################
+/**Sends the outgoing psi of an angle set whose sweep chunk has been
+ * executed, clears its local and receive buffers and updates the
+ * boundary readiness. Must be called from the thread that owns MPI.*/
+void chi_mesh::sweep_management::AngleSet::
+CompleteExecution(int angle_set_num)
+{
+  //Send outgoing psi and clear local and receive buffers
+  sweep_buffer.SendDownstreamPsi(angle_set_num);
+  sweep_buffer.ClearLocalAndReceiveBuffers();
+
+  //Update boundary readiness
+  for (auto bndry : ref_boundaries)
+    bndry->UpdateAnglesReadyStatus(angles,ref_subset);
+
+  executed = true;
+}
+
 //###################################################################
 /**Returns a reference to the associated spds.*/
 chi_mesh::sweep_management::SPDS*
@@ -173,6 +197,40 @@ void chi_mesh::sweep_management::AngleSet::ReceiveDelayedData(int angle_set_num)
   sweep_buffer.ReceiveDelayedData(angle_set_num);
 }
 
+//###################################################################
+/**Sets the message aggregator of the sweep buffer.*/
+void chi_mesh::sweep_management::AngleSet::
+  SetMessageAggregator(SweepMessageAggregator* msg_aggregator)
+{
+  sweep_buffer.SetMessageAggregator(msg_aggregator);
+}
+
+//###################################################################
+/**Hands aggregated upstream psi to the sweep buffer.*/
+bool chi_mesh::sweep_management::AngleSet::
+  ReceiveAggregatedPsi(int angle_set_num, int locJ,
+                       const char* data, u_ll_int num_bytes)
+{
+  return sweep_buffer.ReceiveAggregatedPsi(angle_set_num,locJ,data,num_bytes);
+}
+
+//###################################################################
+/**Appends the MPI requests this angle set is waiting on. Sends are
+ * only included once the angle set has executed.*/
+void chi_mesh::sweep_management::AngleSet::
+  GetPendingRequests(std::vector<MPI_Request>& requests,
+                     std::vector<int>& request_ids)
+{
+  sweep_buffer.GetPendingRequests(requests,request_ids,executed);
+}
+
+//###################################################################
+/**Records the completion of a pending request.*/
+void chi_mesh::sweep_management::AngleSet::CompleteRequest(int request_id)
+{
+  sweep_buffer.CompleteRequest(request_id);
+}
+
 //###################################################################
 /**Returns a pointer to a boundary flux data.*/
 double* chi_mesh::sweep_management::AngleSet::
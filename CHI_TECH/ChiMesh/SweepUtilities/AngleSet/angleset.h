@@ -40,13 +40,23 @@ public:
   std::vector<double>               delayed_prelocI_norm;
   double                            delayed_local_norm;
 
+  //Single precision storage of the non-delayed interface psi. Used
+  //instead of local_psi, deplocI_outgoing_psi and prelocI_outgoing_psi
+  //when single_precision_psi is set. The psi of delayed successors stays
+  //in deplocI_outgoing_psi.
+  bool                              single_precision_psi;
+  std::vector<std::vector<float>>   local_psi_f;
+  std::vector<std::vector<float>>   deplocI_outgoing_psi_f;
+  std::vector<std::vector<float>>   prelocI_outgoing_psi_f;
+
   AngleSet(int in_numgrps,
            int in_ref_subset,
            SPDS* in_spds,
            std::vector<int>& angle_indices,
            std::vector<SweepBndry*>& sim_boundaries,
            int sweep_eager_limit,
-           ChiMPICommunicatorSet* in_comm_set);
+           ChiMPICommunicatorSet* in_comm_set,
+           bool in_single_precision_psi=false);
 
   AngleSet(int in_numgrps,
            int in_ref_subset,
@@ -55,7 +65,8 @@ public:
            std::vector<int>& angle_indices,
            std::vector<SweepBndry*>& sim_boundaries,
            int sweep_eager_limit,
-           ChiMPICommunicatorSet* in_comm_set);
+           ChiMPICommunicatorSet* in_comm_set,
+           bool in_single_precision_psi=false);
 
   void InitializeDelayedUpstreamData();
 
@@ -72,8 +83,18 @@ public:
              int angle_set_num,
              const std::vector<size_t>& timing_tags,
              ExecutionPermission permission = ExecutionPermission::EXECUTE);
+  void PrepareForExecution();
+  void CompleteExecution(int angle_set_num);
   void ResetSweepBuffers();
   void ReceiveDelayedData(int angle_set_num);
+  void SetMessageAggregator(SweepMessageAggregator* msg_aggregator);
+  bool ReceiveAggregatedPsi(int angle_set_num, int locJ,
+                            const char* data, u_ll_int num_bytes);
+  void GetPendingRequests(std::vector<MPI_Request>& requests,
+                          std::vector<int>& request_ids);
+  void CompleteRequest(int request_id);
+  bool DelayedReceivesPending() const
+  {return sweep_buffer.DelayedReceivesPending();}
 
   double* PsiBndry(int bndry_map,
                    int angle_num,
@@ -75,6 +75,9 @@ private:
   // psi vector that hold faces of the same category.
   std::vector<std::vector<int>>& so_cell_inco_face_face_category;
 
+  // Precomputed face traversal used by sweep chunks
+  const SweepPlan& sweep_plan;
+
   //Inherited from base FLUDS
 //public:
 //  // This is a small vector [deplocI] that holds the number of
@@ -144,6 +147,16 @@ public:
 
   double*  NLUpwindPsi(int nonl_inc_face_counter,
                        int face_dof,int g, int n) override;
+
+  float*   OutgoingPsiF(int cell_so_index, int outb_face_counter,
+                        int face_dof, int n) override;
+  float*   UpwindPsiF(int cell_so_index, int inc_face_counter,
+                      int face_dof,int g, int n) override;
+  float*   NLOutgoingPsiF(int outb_face_count,int face_dof, int n) override;
+  float*   NLUpwindPsiF(int nonl_inc_face_counter,
+                        int face_dof,int g, int n) override;
+
+  const SweepPlan& GetSweepPlan() const override {return sweep_plan;}
 };
 
 #endif
\ No newline at end of file
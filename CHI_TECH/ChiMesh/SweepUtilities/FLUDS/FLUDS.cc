@@ -162,3 +162,97 @@ NLUpwindPsi(int nonl_inc_face_counter,
 
 }
 
+//###################################################################
+/**Single precision counterpart of OutgoingPsi. Returns nullptr when
+ * the face is delayed, in which case its psi is stored in double
+ * precision and OutgoingPsi must be used.*/
+float*  chi_mesh::sweep_management::PRIMARY_FLUDS::
+OutgoingPsiF(int cell_so_index, int outb_face_counter,
+             int face_dof, int n)
+{
+  // Face category
+  int fc = so_cell_outb_face_face_category[cell_so_index][outb_face_counter];
+
+  if (fc < 0) return nullptr;
+
+  size_t index =
+    local_psi_Gn_block_strideG[fc]*n +
+    so_cell_outb_face_slot_indices[cell_so_index][outb_face_counter]*
+    local_psi_stride[fc]*G +
+    face_dof*G;
+
+  return &(ref_local_psi_f->operator[](fc))[index];
+}
+
+//###################################################################
+/**Single precision counterpart of NLOutgoingPsi. Returns nullptr when
+ * the successor is delayed, in which case its psi is stored in double
+ * precision and NLOutgoingPsi must be used.*/
+float*  chi_mesh::sweep_management::PRIMARY_FLUDS::
+NLOutgoingPsiF(int outb_face_counter,
+               int face_dof, int n)
+{
+  int depLocI = nonlocal_outb_face_deplocI_slot[outb_face_counter].first;
+  int slot    = nonlocal_outb_face_deplocI_slot[outb_face_counter].second;
+  int nonlocal_psi_Gn_blockstride = deplocI_face_dof_count[depLocI];
+
+  //Only non-delayed successors have a single precision buffer
+  auto& outgoing_psi_f = ref_deplocI_outgoing_psi_f->operator[](depLocI);
+  if (outgoing_psi_f.empty()) return nullptr;
+
+  size_t index =
+    nonlocal_psi_Gn_blockstride*G*n +
+    slot*G + face_dof*G;
+
+  return &outgoing_psi_f[index];
+}
+
+//###################################################################
+/**Single precision counterpart of UpwindPsi. Returns nullptr when
+ * the face is delayed.*/
+float*  chi_mesh::sweep_management::PRIMARY_FLUDS::
+UpwindPsiF(int cell_so_index, int inc_face_counter,
+           int face_dof,int g, int n)
+{
+  // Face category
+  int fc = so_cell_inco_face_face_category[cell_so_index][inc_face_counter];
+
+  if (fc < 0) return nullptr;
+
+  size_t index =
+    local_psi_Gn_block_strideG[fc]*n +
+    so_cell_inco_face_dof_indices[cell_so_index][inc_face_counter].first*
+    local_psi_stride[fc]*G +
+    so_cell_inco_face_dof_indices[cell_so_index][inc_face_counter].
+      second[face_dof]*G + g;
+
+  return &(ref_local_psi_f->operator[](fc))[index];
+}
+
+//###################################################################
+/**Single precision counterpart of NLUpwindPsi. Returns nullptr when
+ * the face is delayed.*/
+float*  chi_mesh::sweep_management::PRIMARY_FLUDS::
+NLUpwindPsiF(int nonl_inc_face_counter,
+             int face_dof,int g, int n)
+{
+  int prelocI =
+    nonlocal_inc_face_prelocI_slot_dof[nonl_inc_face_counter].first;
+
+  if (prelocI < 0) return nullptr;
+
+  int nonlocal_psi_Gn_blockstride = prelocI_face_dof_count[prelocI];
+  int slot =
+    nonlocal_inc_face_prelocI_slot_dof[nonl_inc_face_counter].second.first;
+
+  int mapped_dof =
+    nonlocal_inc_face_prelocI_slot_dof[nonl_inc_face_counter].
+      second.second[face_dof];
+
+  size_t index =
+    nonlocal_psi_Gn_blockstride*G*n +
+    slot*G +
+    mapped_dof*G + g;
+
+  return &ref_prelocI_outgoing_psi_f->operator[](prelocI)[index];
+}
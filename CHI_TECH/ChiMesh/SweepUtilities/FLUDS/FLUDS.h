@@ -15,6 +15,37 @@ typedef std::pair<int,std::vector<CompactFaceView>> CompactCellView;
 
 namespace chi_mesh::sweep_management
 {
+  //###################################################################
+  /**Face traversal of all the cells of an SPDS, in sweep order, stored
+   * in flat arrays. Incoming and outgoing faces of cell csoi are
+   * stored in [cell_inco_face_start[csoi],cell_inco_face_start[csoi+1])
+   * and [cell_outb_face_start[csoi],cell_outb_face_start[csoi+1]).*/
+  struct SweepPlan
+  {
+    enum FaceKind : char
+    {
+      FACE_LOCAL    = 0, ///< Neighbor is a local cell
+      FACE_NONLOCAL = 1, ///< Neighbor is on another location
+      FACE_BOUNDARY = 2  ///< Face is on a boundary
+    };
+
+    struct Face
+    {
+      short    f;             ///< Face index on the cell
+      FaceKind kind;
+      short    num_dofs;      ///< Number of face dofs
+      int      index;         ///< Local face counter, preloc/deploc face
+                              ///< counter, or cell boundary face counter.
+      int      dof_map_start; ///< Face dof to cell dof map in face_dof_map
+    };
+
+    std::vector<int>  cell_inco_face_start;
+    std::vector<int>  cell_outb_face_start;
+    std::vector<Face> inco_faces;
+    std::vector<Face> outb_faces;
+    std::vector<int>  face_dof_map;
+  };
+
   class FLUDS
   {
   public:
@@ -66,6 +97,42 @@ namespace chi_mesh::sweep_management
     virtual
     double*  NLUpwindPsi(int nonl_inc_face_counter,
                          int face_dof,int g, int n) = 0;
+
+    //Single precision psi. Only the non-delayed interface psi is stored
+    //in single precision, delayed psi is always stored in double
+    //precision and the F accessors return nullptr for delayed faces.
+  protected:
+    std::vector<std::vector<float>>*  ref_local_psi_f = nullptr;
+    std::vector<std::vector<float>>*  ref_deplocI_outgoing_psi_f = nullptr;
+    std::vector<std::vector<float>>*  ref_prelocI_outgoing_psi_f = nullptr;
+
+  public:
+    /**Passes pointers to the single precision psi vectors of sweep
+     * buffers.*/
+    void SetReferencePsiSingle(
+      std::vector<std::vector<float>>*  local_psi,
+      std::vector<std::vector<float>>*  deplocI_outgoing_psi,
+      std::vector<std::vector<float>>*  prelocI_outgoing_psi)
+    {
+      ref_local_psi_f            = local_psi;
+      ref_deplocI_outgoing_psi_f = deplocI_outgoing_psi;
+      ref_prelocI_outgoing_psi_f = prelocI_outgoing_psi;
+    }
+
+    virtual
+    float*   OutgoingPsiF(int cell_so_index, int outb_face_counter,
+                          int face_dof, int n) = 0;
+    virtual
+    float*   UpwindPsiF(int cell_so_index, int inc_face_counter,
+                        int face_dof,int g, int n) = 0;
+    virtual
+    float*   NLOutgoingPsiF(int outb_face_count,int face_dof, int n) = 0;
+    virtual
+    float*   NLUpwindPsiF(int nonl_inc_face_counter,
+                          int face_dof,int g, int n) = 0;
+
+    virtual
+    const SweepPlan& GetSweepPlan() const = 0;
   };
 }
 
@@ -144,6 +211,9 @@ private:
   std::vector<std::vector<int>>
     so_cell_inco_face_face_category;
 
+  // Precomputed face traversal used by sweep chunks
+  SweepPlan sweep_plan;
+
   //Inherited from base FLUDS
 //public:
 //  // This is a small vector [deplocI] that holds the number of
@@ -242,11 +312,14 @@ public:
                     chi_mesh::sweep_management::SPDS* spds,
                     std::vector<std::vector<std::pair<int,short>>>& lock_boxes,
                     std::vector<std::pair<int,short>>& delayed_lock_box,
-                    std::set<int>& location_boundary_dependency_set);
+                    std::set<int>& location_boundary_dependency_set,
+                    std::vector<std::pair<int,int>>* deferred_releases=nullptr);
   //alphapass_inc_mapping.cc
   void LocalIncidentMapping(chi_mesh::Cell *cell,
                             chi_mesh::sweep_management::SPDS* spds,
                             std::vector<int>&  local_so_cell_mapping);
+  //alphapass_sweepplan.cc
+  void BuildSweepPlan(chi_mesh::sweep_management::SPDS* spds);
 
   //betapass.cc
   void InitializeBetaElements(chi_mesh::sweep_management::SPDS *spds,
@@ -275,6 +348,16 @@ public:
   double*  NLUpwindPsi(int nonl_inc_face_counter,
                        int face_dof,int g, int n) override;
 
+  float*   OutgoingPsiF(int cell_so_index, int outb_face_counter,
+                        int face_dof, int n) override;
+  float*   UpwindPsiF(int cell_so_index, int inc_face_counter,
+                      int face_dof,int g, int n) override;
+  float*   NLOutgoingPsiF(int outb_face_count,int face_dof, int n) override;
+  float*   NLUpwindPsiF(int nonl_inc_face_counter,
+                        int face_dof,int g, int n) override;
+
+  const SweepPlan& GetSweepPlan() const override {return sweep_plan;}
+
 };
 
 #endif
\ No newline at end of file
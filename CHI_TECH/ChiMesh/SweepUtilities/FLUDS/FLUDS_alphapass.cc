@@ -44,6 +44,14 @@ InitializeAlphaElements(chi_mesh::sweep_management::SPDS* spds)
   LockBox              delayed_lock_box;
   std::set<int> location_boundary_dependency_set;
 
+  // For level ordered sweeps the cells of a level can execute
+  // concurrently. A slot consumed within a level is therefore only
+  // opened once the level is complete, otherwise a cell could overwrite
+  // data another cell of the same level has not read yet.
+  const bool level_ordered = not spls->level_start.empty();
+  std::vector<std::pair<int,int>> deferred_releases;
+  size_t level = 0;
+
   // csoi = cell sweep order index
   for (int csoi=0; csoi<spls->item_id.size(); csoi++)
   {
@@ -51,8 +59,21 @@ InitializeAlphaElements(chi_mesh::sweep_management::SPDS* spds)
     auto cell         = grid->cells[cell_g_index];
     local_so_cell_mapping[cell->cell_local_id] = csoi; //Set mapping
 
-    SlotDynamics(cell,spds,lock_boxes,delayed_lock_box,location_boundary_dependency_set);
+    SlotDynamics(cell,spds,lock_boxes,delayed_lock_box,
+                 location_boundary_dependency_set,
+                 level_ordered? &deferred_releases : nullptr);
 
+    //=========================================== Open slots at level end
+    if (level_ordered and (csoi+1) == spls->level_start[level+1])
+    {
+      for (auto& release : deferred_releases)
+      {
+        lock_boxes[release.first][release.second].first = -1;
+        lock_boxes[release.first][release.second].second= -1;
+      }
+      deferred_releases.clear();
+      ++level;
+    }
   }//for csoi
 
 
@@ -73,6 +94,9 @@ InitializeAlphaElements(chi_mesh::sweep_management::SPDS* spds)
 
   }//for csoi
 
+  //                      BUILD SWEEP PLAN
+  BuildSweepPlan(spds);
+
   for (size_t fc=0; fc<num_face_categories; ++fc)
   {
     local_psi_stride[fc] = grid->GetFaceHistogramBinDOFSize(fc);
@@ -10,13 +10,17 @@ typedef std::vector<std::pair<int,short>> LockBox;
 extern ChiLog chi_log;
 
 //###################################################################
-/**Performs slot dynamics for Polyhedron cell.*/
+/**Performs slot dynamics for Polyhedron cell. If deferred_releases is
+ * supplied, the slots consumed by incident faces are not opened but
+ * their (face category, slot) pairs are appended to it so that the caller
+ * can open them later (e.g. at the end of a sweep level).*/
 void chi_mesh::sweep_management::PRIMARY_FLUDS::
   SlotDynamics(chi_mesh::Cell *cell,
                chi_mesh::sweep_management::SPDS* spds,
                std::vector<std::vector<std::pair<int,short>>>& lock_boxes,
                std::vector<std::pair<int,short>>& delayed_lock_box,
-               std::set<int>& location_boundary_dependency_set)
+               std::set<int>& location_boundary_dependency_set,
+               std::vector<std::pair<int,int>>* deferred_releases)
 {
   chi_mesh::MeshContinuum* grid = spds->grid;
 
@@ -76,8 +80,13 @@ void chi_mesh::sweep_management::PRIMARY_FLUDS::
           if ((lock_box[k].first == neighbor) &&
               (lock_box[k].second== ass_face))
           {
-            lock_box[k].first = -1;
-            lock_box[k].second= -1;
+            if (deferred_releases != nullptr)
+              deferred_releases->emplace_back(face_categ,k);
+            else
+            {
+              lock_box[k].first = -1;
+              lock_box[k].second= -1;
+            }
             found = true;
             break;
           }
@@ -0,0 +1,139 @@
+#include "FLUDS.h"
+#include "ChiMesh/SweepUtilities/SPDS/SPDS.h"
+
+#include <ChiMesh/Cell/cell.h>
+
+#include <chi_log.h>
+
+extern ChiLog chi_log;
+
+//###################################################################
+/**Builds the sweep plan. For every cell, in sweep order, the incoming
+ * and outgoing faces are classified once with the SPDS direction and
+ * stored with their face counters and face-dof to cell-dof maps.
+ * The face classification and the counters are identical to those
+ * used by SlotDynamics and the incident mappings.*/
+void chi_mesh::sweep_management::PRIMARY_FLUDS::
+BuildSweepPlan(chi_mesh::sweep_management::SPDS* spds)
+{
+  chi_mesh::MeshContinuum*          grid = spds->grid;
+  chi_mesh::sweep_management::SPLS* spls = spds->spls;
+
+  size_t num_loc_cells = spls->item_id.size();
+
+  sweep_plan.cell_inco_face_start.clear();
+  sweep_plan.cell_outb_face_start.clear();
+  sweep_plan.inco_faces.clear();
+  sweep_plan.outb_faces.clear();
+  sweep_plan.face_dof_map.clear();
+
+  sweep_plan.cell_inco_face_start.reserve(num_loc_cells+1);
+  sweep_plan.cell_outb_face_start.reserve(num_loc_cells+1);
+
+  int preloc_face_counter = -1;
+  int deploc_face_counter = -1;
+
+  //================================================== Loop over cells in
+  //                                                   sweep order
+  for (int csoi=0; csoi<num_loc_cells; csoi++)
+  {
+    int  cell_g_index = spls->item_id[csoi];
+    auto cell         = grid->cells[cell_g_index];
+
+    sweep_plan.cell_inco_face_start.push_back(sweep_plan.inco_faces.size());
+    sweep_plan.cell_outb_face_start.push_back(sweep_plan.outb_faces.size());
+
+    int in_face_counter   = -1;
+    int out_face_counter  = -1;
+    int bndry_face_counter= -1;
+    for (short f=0; f < cell->faces.size(); f++)
+    {
+      CellFace& face     = cell->faces[f];
+      double    mu       = spds->omega.Dot(face.normal);
+      int       neighbor = face.neighbor;
+
+      bool is_bndry = grid->IsCellBndry(neighbor);
+      if (is_bndry) bndry_face_counter++;
+
+      SweepPlan::Face plan_face;
+      plan_face.f             = f;
+      plan_face.num_dofs      = face.vertex_ids.size();
+      plan_face.dof_map_start = sweep_plan.face_dof_map.size();
+
+      //=========================================== Incident face
+      if (mu<(0.0-1.0e-16))
+      {
+        if (grid->IsCellLocal(neighbor))
+        {
+          plan_face.kind  = SweepPlan::FACE_LOCAL;
+          plan_face.index = ++in_face_counter;
+        }
+        else if (is_bndry)
+        {
+          plan_face.kind  = SweepPlan::FACE_BOUNDARY;
+          plan_face.index = bndry_face_counter;
+        }
+        else
+        {
+          plan_face.kind  = SweepPlan::FACE_NONLOCAL;
+          plan_face.index = ++preloc_face_counter;
+        }
+        sweep_plan.inco_faces.push_back(plan_face);
+      }
+      //=========================================== Outgoing face
+      else if (mu>=(0.0+1.0e-16))
+      {
+        if (grid->IsCellLocal(neighbor))
+        {
+          plan_face.kind  = SweepPlan::FACE_LOCAL;
+          plan_face.index = ++out_face_counter;
+        }
+        else if (is_bndry)
+        {
+          plan_face.kind  = SweepPlan::FACE_BOUNDARY;
+          plan_face.index = bndry_face_counter;
+          ++out_face_counter;
+        }
+        else
+        {
+          plan_face.kind  = SweepPlan::FACE_NONLOCAL;
+          plan_face.index = ++deploc_face_counter;
+          ++out_face_counter;
+        }
+        sweep_plan.outb_faces.push_back(plan_face);
+      }
+      else
+        continue;
+
+      //=========================================== Face dof mapping
+      for (int fv : face.vertex_ids)
+      {
+        int mapping = -1;
+        for (size_t cv=0; cv<cell->vertex_ids.size(); cv++)
+        {
+          if (cell->vertex_ids[cv] == fv)
+          {
+            mapping = cv;
+            break;
+          }
+        }
+        if (mapping<0)
+        {
+          chi_log.Log(LOG_ALLERROR)
+            << "Face vertex not found on cell in call to "
+            << "PRIMARY_FLUDS::BuildSweepPlan. Local Cell "
+            << cell->cell_local_id << " face " << f;
+          exit(EXIT_FAILURE);
+        }
+        sweep_plan.face_dof_map.push_back(mapping);
+      }
+    }//for f
+  }//for csoi
+
+  sweep_plan.cell_inco_face_start.push_back(sweep_plan.inco_faces.size());
+  sweep_plan.cell_outb_face_start.push_back(sweep_plan.outb_faces.size());
+
+  sweep_plan.inco_faces.shrink_to_fit();
+  sweep_plan.outb_faces.shrink_to_fit();
+  sweep_plan.face_dof_map.shrink_to_fit();
+}
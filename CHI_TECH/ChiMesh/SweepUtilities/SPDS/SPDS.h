@@ -14,7 +14,9 @@ struct chi_mesh::sweep_management::SPDS
   chi_mesh::MeshContinuum* grid;
 
   SPLS*                    spls;
-  std::vector<STDG*>       global_sweep_planes;  ///< Processor sweep planes
+  /// Processor sweep planes, one per global sweep order rank. Only this
+  /// location and its (non-delayed) dependencies are listed.
+  std::vector<STDG*>       global_sweep_planes;
   std::vector<int>         location_dependencies;
   std::vector<int>         location_successors;
   std::vector<int>         delayed_location_dependencies;
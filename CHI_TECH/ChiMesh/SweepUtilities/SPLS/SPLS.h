@@ -8,6 +8,11 @@
 struct chi_mesh::sweep_management::SPLS
 {
   std::vector<int> item_id;
+
+  /// Only populated for level ordered sweeps. Cells of level l are stored
+  /// in item_id[level_start[l]] to item_id[level_start[l+1]-1] and have
+  /// no dependencies on one another.
+  std::vector<int> level_start;
   //chi_mesh::sweep_management::FLUDS* fluds;
 };
 
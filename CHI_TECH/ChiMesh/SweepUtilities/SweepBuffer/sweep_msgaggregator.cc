@@ -0,0 +1,179 @@
+#include "sweep_msgaggregator.h"
+
+#include "ChiMesh/SweepUtilities/AngleSet/angleset.h"
+
+#include <cstring>
+#include <algorithm>
+
+#include <chi_log.h>
+extern ChiLog chi_log;
+
+//###################################################################
+/**Constructor. The angle sets are indexed by the angle set numbers
+ * used by the sweep scheduler.*/
+chi_mesh::sweep_management::SweepMessageAggregator::
+  SweepMessageAggregator(ChiMPICommunicatorSet* in_comm_set,
+                         int in_tag,
+                         std::vector<AngleSet*>& in_angle_sets) :
+  comm_set(in_comm_set),
+  tag(in_tag),
+  angle_sets(in_angle_sets)
+{}
+
+//###################################################################
+/**Destructor. Completes outstanding sends.*/
+chi_mesh::sweep_management::SweepMessageAggregator::~SweepMessageAggregator()
+{
+  int finalized = 0;
+  MPI_Finalized(&finalized);
+  if (not finalized) CompleteSends();
+}
+
+//###################################################################
+/**Appends the outgoing psi of an angle set to the aggregate message of
+ * the destination location. The data is copied, the caller's buffer
+ * can be released immediately.*/
+void chi_mesh::sweep_management::SweepMessageAggregator::
+  Queue(int locJ, int angle_set_num, const void* data, u_ll_int num_bytes)
+{
+  auto& buffer = outgoing[locJ];
+
+  size_t offset = buffer.size();
+  buffer.resize(offset + sizeof(int) + sizeof(u_ll_int) + num_bytes);
+
+  char* dest = buffer.data() + offset;
+  std::memcpy(dest, &angle_set_num, sizeof(int));
+  dest += sizeof(int);
+  std::memcpy(dest, &num_bytes, sizeof(u_ll_int));
+  dest += sizeof(u_ll_int);
+  std::memcpy(dest, data, num_bytes);
+}
+
+//###################################################################
+/**Sends one message to every destination that has queued data. Also
+ * releases the buffers of completed sends.*/
+void chi_mesh::sweep_management::SweepMessageAggregator::Flush()
+{
+  //======================================== Release completed sends
+  for (auto& message : in_flight)
+  {
+    int done = 0;
+    MPI_Test(&message->request, &done, MPI_STATUS_IGNORE);
+    if (done) {delete message; message = nullptr;}
+  }
+  in_flight.erase(std::remove(in_flight.begin(), in_flight.end(), nullptr),
+                  in_flight.end());
+
+  //======================================== Send aggregates
+  for (auto& dest_buffer : outgoing)
+  {
+    if (dest_buffer.second.empty()) continue;
+
+    auto message = new SentMessage;
+    message->buffer.swap(dest_buffer.second);
+
+    MPI_Isend(message->buffer.data(),
+              message->buffer.size(),
+              MPI_BYTE,
+              dest_buffer.first,
+              tag,
+              comm_set->comm,
+              &message->request);
+
+    in_flight.push_back(message);
+  }
+}
+
+//###################################################################
+/**Receives all the aggregate messages that have arrived and hands
+ * every entry to the sweep buffer of its angle set. Entries for an
+ * angle set that has not yet consumed the previous data from the same
+ * location are stashed and delivered on a later call.*/
+void chi_mesh::sweep_management::SweepMessageAggregator::Receive()
+{
+  //======================================== Retry stashed entries
+  for (auto it = stashed.begin(); it != stashed.end(); )
+  {
+    if (Deliver(it->locJ, it->angle_set_num,
+                it->payload.data(), it->payload.size()))
+      it = stashed.erase(it);
+    else
+      ++it;
+  }
+
+  //======================================== Receive new aggregates
+  int        flag = 1;
+  MPI_Status status;
+  while (flag)
+  {
+    MPI_Iprobe(MPI_ANY_SOURCE, tag, comm_set->comm, &flag, &status);
+    if (not flag) break;
+
+    int num_bytes = 0;
+    MPI_Get_count(&status, MPI_BYTE, &num_bytes);
+
+    int locJ = status.MPI_SOURCE;
+    recv_buffer.resize(num_bytes);
+    MPI_Recv(recv_buffer.data(), num_bytes, MPI_BYTE,
+             locJ, tag, comm_set->comm, MPI_STATUS_IGNORE);
+
+    //================================= Unpack entries
+    const char* data = recv_buffer.data();
+    const char* end  = data + num_bytes;
+    while (data < end)
+    {
+      int      angle_set_num = 0;
+      u_ll_int entry_bytes   = 0;
+      std::memcpy(&angle_set_num, data, sizeof(int));
+      data += sizeof(int);
+      std::memcpy(&entry_bytes, data, sizeof(u_ll_int));
+      data += sizeof(u_ll_int);
+
+      if (not Deliver(locJ, angle_set_num, data, entry_bytes))
+        stashed.push_back({locJ, angle_set_num,
+                           std::vector<char>(data, data + entry_bytes)});
+
+      data += entry_bytes;
+    }
+  }
+}
+
+//###################################################################
+/**Blocks until an aggregate message has arrived. Returns immediately if
+ * stashed entries are waiting for delivery.*/
+void chi_mesh::sweep_management::SweepMessageAggregator::WaitForMessage()
+{
+  if (not stashed.empty()) return;
+
+  MPI_Probe(MPI_ANY_SOURCE, tag, comm_set->comm, MPI_STATUS_IGNORE);
+}
+
+//###################################################################
+/**Waits for all aggregate sends to complete.*/
+void chi_mesh::sweep_management::SweepMessageAggregator::CompleteSends()
+{
+  for (auto message : in_flight)
+  {
+    MPI_Wait(&message->request, MPI_STATUS_IGNORE);
+    delete message;
+  }
+  in_flight.clear();
+}
+
+//###################################################################
+/**Hands an entry to the angle set. Returns false if the angle set
+ * cannot accept it yet.*/
+bool chi_mesh::sweep_management::SweepMessageAggregator::
+  Deliver(int locJ, int angle_set_num, const char* data, u_ll_int num_bytes)
+{
+  if (angle_set_num < 0 or angle_set_num >= angle_sets.size())
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "SweepMessageAggregator: Invalid angle set number "
+      << angle_set_num << " received from location " << locJ << ".";
+    exit(EXIT_FAILURE);
+  }
+
+  return angle_sets[angle_set_num]->
+    ReceiveAggregatedPsi(angle_set_num, locJ, data, num_bytes);
+}
@@ -0,0 +1,71 @@
+#ifndef _chi_sweep_msgaggregator_h
+#define _chi_sweep_msgaggregator_h
+
+#include "ChiMesh/SweepUtilities/sweep_namespace.h"
+#include <chi_mpi.h>
+
+#include <map>
+
+typedef unsigned long long int u_ll_int;
+
+namespace chi_mesh::sweep_management
+{
+
+//###################################################################
+/**Packs the outgoing psi of all the angle sets that completed during
+ * one pass of a sweep scheduler into a single message per downstream
+ * location. An aggregate message is a sequence of entries, each being
+ * the angle set number (int), the payload size in bytes (u_ll_int)
+ * and the payload itself, i.e. the complete deplocI block of the angle
+ * set. On the receiving side every entry is handed to the sweep buffer
+ * of the corresponding angle set.
+ *
+ * Data for delayed successors is not aggregated since it is received
+ * with the delayed persistent receives after the sweep.*/
+class SweepMessageAggregator
+{
+private:
+  ChiMPICommunicatorSet* const    comm_set;
+  const int                       tag;
+  std::vector<AngleSet*>          angle_sets; ///< Indexed by angle set num
+
+  std::map<int,std::vector<char>> outgoing;   ///< Per destination locJ
+
+  struct SentMessage
+  {
+    std::vector<char> buffer;
+    MPI_Request       request = MPI_REQUEST_NULL;
+  };
+  std::vector<SentMessage*>       in_flight;
+
+  struct StashedEntry
+  {
+    int               locJ;
+    int               angle_set_num;
+    std::vector<char> payload;
+  };
+  std::vector<StashedEntry>       stashed;
+
+  std::vector<char>               recv_buffer;
+
+public:
+  SweepMessageAggregator(ChiMPICommunicatorSet* in_comm_set,
+                         int in_tag,
+                         std::vector<AngleSet*>& in_angle_sets);
+  ~SweepMessageAggregator();
+
+  void Queue(int locJ, int angle_set_num,
+             const void* data, u_ll_int num_bytes);
+  void Flush();
+  void Receive();
+  void WaitForMessage();
+  void CompleteSends();
+
+private:
+  bool Deliver(int locJ, int angle_set_num,
+               const char* data, u_ll_int num_bytes);
+};
+
+}
+
+#endif
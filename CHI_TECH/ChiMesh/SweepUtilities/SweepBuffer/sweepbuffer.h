@@ -50,7 +50,31 @@ private:
 
   std::vector<std::vector<MPI_Request>> deplocI_message_request;
 
-
+  //True when the psi sent to deplocI is single precision. Delayed
+  //successors always receive double precision psi.
+  std::vector<bool> deplocI_single_precision;
+
+  //Persistent receives, created once and started at the beginning of
+  //every sweep. The request arrays are flat over all messages.
+  bool recv_requests_initialized;
+  bool delayed_recv_requests_initialized;
+  bool delayed_recv_requests_started;
+  int  num_pending_recvs;
+
+  //The delayed data of a sweep is completed lazily, either when the
+  //angle set first checks its upstream data in the next sweep or when
+  //the delayed psi is accessed through ReceiveDelayedData.
+  bool delayed_data_pending;
+
+  std::vector<MPI_Request>         prelocI_recv_request;
+  std::vector<std::pair<int,int>>  prelocI_recv_request_map; ///< (prelocI,m)
+  std::vector<int>                 recv_completed_indices;
+  std::vector<MPI_Request>         delayed_prelocI_recv_request;
+  std::vector<std::vector<double>> delayed_prelocI_psi_prev;  ///< Before recv
+
+  //Optional aggregation of the non-delayed downstream messages. When
+  //set, upstream psi arrives through ReceiveAggregatedPsi.
+  SweepMessageAggregator*          msg_aggregator;
 
 public:
   int max_num_mess;
@@ -58,6 +82,7 @@ public:
   SweepBuffer(chi_mesh::sweep_management::AngleSet* ref_angleset,
               int sweep_eager_limit,
               ChiMPICommunicatorSet* in_comm_set);
+  ~SweepBuffer();
   bool DoneSending();
   void BuildMessageStructure();
   void InitializeDelayedUpstreamData();
@@ -69,6 +94,24 @@ public:
   void ClearLocalAndReceiveBuffers();
   void Reset();
 
+  void SetMessageAggregator(SweepMessageAggregator* in_msg_aggregator);
+  bool ReceiveAggregatedPsi(int angle_set_num, int locJ,
+                            const char* data, u_ll_int num_bytes);
+
+  void GetPendingRequests(std::vector<MPI_Request>& requests,
+                          std::vector<int>& request_ids,
+                          bool include_sends);
+  void CompleteRequest(int request_id);
+  bool DelayedReceivesPending() const
+  {return delayed_data_pending and delayed_recv_requests_started;}
+
+private:
+  void InitializePersistentReceives(int angle_set_num);
+  void StartPersistentReceives(bool start_upstream);
+  bool TestDelayedReceives();
+  int  NumSendRequests();
+  void FreePersistentReceives();
+
 };
 }
 #endif
\ No newline at end of file
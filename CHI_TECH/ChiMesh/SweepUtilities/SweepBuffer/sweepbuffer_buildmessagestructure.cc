@@ -8,6 +8,8 @@
 #include <chi_mpi.h>
 #include <ChiConsole/chi_console.h>
 
+#include <algorithm>
+
 extern ChiLog     chi_log;
 extern ChiMPI     chi_mpi;
 extern ChiConsole chi_console;
@@ -38,6 +40,11 @@ void chi_mesh::sweep_management::SweepBuffer::BuildMessageStructure()
   int num_grps   = angleset->GetNumGrps();
   int num_angles = angleset->angles.size();
 
+  //Bytes per psi value in non-delayed messages. Delayed psi is always
+  //communicated in double precision.
+  int psi_bytes         = (angleset->single_precision_psi)? sizeof(float) : sizeof(double);
+  int delayed_psi_bytes = sizeof(double);
+
   //============================================= Predecessor locations
   size_t num_dependencies = spds->location_dependencies.size();
 
@@ -53,14 +60,14 @@ void chi_mesh::sweep_management::SweepBuffer::BuildMessageStructure()
 
     u_ll_int message_size  = num_unknowns;
     int      message_count = 1;
-    if ((num_unknowns*8)<=EAGER_LIMIT)
+    if ((num_unknowns*psi_bytes)<=EAGER_LIMIT)
     {
       message_count = num_angles;
       message_size  = ceil((double)num_unknowns/(double)message_count);
     }
     else
     {
-      message_count = ceil((double)num_unknowns*8/(double)(double)EAGER_LIMIT);
+      message_count = ceil((double)num_unknowns*psi_bytes/(double)(double)EAGER_LIMIT);
       message_size  = ceil((double)num_unknowns/(double)message_count);
     }
 
@@ -100,14 +107,14 @@ void chi_mesh::sweep_management::SweepBuffer::BuildMessageStructure()
 
     u_ll_int message_size  = num_unknowns;
     int      message_count = 1;
-    if ((num_unknowns*8)<=EAGER_LIMIT)
+    if ((num_unknowns*delayed_psi_bytes)<=EAGER_LIMIT)
     {
       message_count = num_angles;
       message_size  = ceil((double)num_unknowns/(double)message_count);
     }
     else
     {
-      message_count = ceil((double)num_unknowns*8/(double)(double)EAGER_LIMIT);
+      message_count = ceil((double)num_unknowns*delayed_psi_bytes/(double)(double)EAGER_LIMIT);
       message_size  = ceil((double)num_unknowns/(double)message_count);
     }
 
@@ -140,22 +147,32 @@ void chi_mesh::sweep_management::SweepBuffer::BuildMessageStructure()
 
   deplocI_message_sent.clear();
   deplocI_message_request.clear();
+  deplocI_single_precision.assign(num_successors,false);
 
+  const auto& delayed_successors = spds->delayed_location_successors;
   for (size_t deplocI=0; deplocI<num_successors; deplocI++)
   {
+    int  locJ       = spds->location_successors[deplocI];
+    bool is_delayed = std::find(delayed_successors.begin(),
+                                delayed_successors.end(),
+                                locJ) != delayed_successors.end();
+    deplocI_single_precision[deplocI] =
+      angleset->single_precision_psi and (not is_delayed);
+    int dep_psi_bytes = (is_delayed)? delayed_psi_bytes : psi_bytes;
+
     u_ll_int num_unknowns =
       fluds->deplocI_face_dof_count[deplocI]*num_grps*num_angles;
 
     u_ll_int message_size  = num_unknowns;
     int      message_count = 1;
-    if ((num_unknowns*8)<=EAGER_LIMIT)
+    if ((num_unknowns*dep_psi_bytes)<=EAGER_LIMIT)
     {
       message_count = num_angles;
       message_size  = ceil((double)num_unknowns/(double)message_count);
     }
     else
     {
-      message_count = ceil((double)num_unknowns*8/(double)(double)EAGER_LIMIT);
+      message_count = ceil((double)num_unknowns*dep_psi_bytes/(double)(double)EAGER_LIMIT);
       message_size  = ceil((double)num_unknowns/(double)message_count);
     }
 
@@ -181,7 +198,7 @@ void chi_mesh::sweep_management::SweepBuffer::BuildMessageStructure()
     }
 
     deplocI_message_sent.emplace_back(message_count,false);
-    deplocI_message_request.emplace_back(message_count,MPI_Request());
+    deplocI_message_request.emplace_back(message_count,MPI_REQUEST_NULL);
   }
 
   angleset->fluds->SetReferencePsi(&angleset->local_psi,
@@ -192,6 +209,9 @@ void chi_mesh::sweep_management::SweepBuffer::BuildMessageStructure()
                                    &angleset->boundryI_incoming_psi,
                                    &angleset->delayed_prelocI_outgoing_psi,
                                    &angleset->delayed_prelocI_outgoing_psi_old);
+  angleset->fluds->SetReferencePsiSingle(&angleset->local_psi_f,
+                                         &angleset->deplocI_outgoing_psi_f,
+                                         &angleset->prelocI_outgoing_psi_f);
 
   //================================================== All reduce to get
   //                                                   maximum message count
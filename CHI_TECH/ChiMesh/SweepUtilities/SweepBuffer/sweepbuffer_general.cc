@@ -17,9 +17,34 @@ SweepBuffer(chi_mesh::sweep_management::AngleSet* ref_angleset,
   upstream_data_initialized = false;
   EAGER_LIMIT = sweep_eager_limit;
 
+  recv_requests_initialized = false;
+  delayed_recv_requests_initialized = false;
+  delayed_recv_requests_started = false;
+  num_pending_recvs = 0;
+  delayed_data_pending = false;
+
+  msg_aggregator = nullptr;
+
   max_num_mess = 0;
 }
 
+//###################################################################
+/**Destructor. Frees the persistent receives.*/
+chi_mesh::sweep_management::SweepBuffer::~SweepBuffer()
+{
+  FreePersistentReceives();
+}
+
+//###################################################################
+/**Sets the aggregator through which the non-delayed downstream psi is
+ * sent and the upstream psi received. A null pointer restores the
+ * per-angle-set messages. Must not be called during a sweep.*/
+void chi_mesh::sweep_management::SweepBuffer::
+  SetMessageAggregator(SweepMessageAggregator* in_msg_aggregator)
+{
+  msg_aggregator = in_msg_aggregator;
+}
+
 //###################################################################
 /**Returns the private flag done_sending.*/
 bool chi_mesh::sweep_management::SweepBuffer::DoneSending()
@@ -28,16 +53,18 @@ bool chi_mesh::sweep_management::SweepBuffer::DoneSending()
 }
 
 //###################################################################
-/**Receive all upstream Psi. This method is called from within
- * an advancement of an angleset, right after execution.*/
+/**Clears the local psi buffers. This method is called from within
+ * an advancement of an angleset, right after execution. The upstream
+ * receive buffers are kept since the persistent receives are bound
+ * to them.*/
 void chi_mesh::sweep_management::SweepBuffer::
 ClearLocalAndReceiveBuffers()
 {
   auto empty_vector = std::vector<std::vector<double>>(0);
   angleset->local_psi.swap(empty_vector);
 
-  empty_vector = std::vector<std::vector<double>>(0);
-  angleset->prelocI_outgoing_psi.swap(empty_vector);
+  auto empty_vector_f = std::vector<std::vector<float>>(0);
+  angleset->local_psi_f.swap(empty_vector_f);
 }
 
 //###################################################################
@@ -65,18 +92,26 @@ ClearDownstreamBuffers()
 
   if (done_sending)
   {
-    for (size_t deplocI=0; deplocI<spds->location_successors.size(); deplocI++)
+    for (auto& psi : angleset->deplocI_outgoing_psi)
+    {
+      psi.clear();
+      psi.shrink_to_fit();
+    }
+    for (auto& psi_f : angleset->deplocI_outgoing_psi_f)
     {
-      angleset->deplocI_outgoing_psi[deplocI].clear();
-      angleset->deplocI_outgoing_psi[deplocI].shrink_to_fit();
+      psi_f.clear();
+      psi_f.shrink_to_fit();
     }
   }
 }
 
 //###################################################################
-/**Reset flags in preperation for another sweep.*/
+/**Reset flags in preperation for another sweep. The delayed data of
+ * the sweep that just ended is marked pending, it is completed by
+ * ReceiveUpstreamPsi or ReceiveDelayedData.*/
 void chi_mesh::sweep_management::SweepBuffer::Reset()
 {
+  delayed_data_pending = true;
   done_sending = false;
   data_initialized = false;
   upstream_data_initialized = false;
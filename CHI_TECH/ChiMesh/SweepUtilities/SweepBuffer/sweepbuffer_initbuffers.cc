@@ -24,26 +24,57 @@ InitializeLocalAndDownstreamBuffers()
     chi_mesh::sweep_management::SPDS*  spds =  angleset->GetSPDS();
     chi_mesh::sweep_management::FLUDS* fluds=  angleset->fluds;
 
+    //============================ Complete sends of the previous sweep
+    //Sweeps are not separated by a barrier, sends to delayed
+    //successors can still be in flight when the buffers are reused.
+    for (auto& deplocI_requests : deplocI_message_request)
+      MPI_Waitall(deplocI_requests.size(),
+                  deplocI_requests.data(),
+                  MPI_STATUSES_IGNORE);
+
     int num_grps   = angleset->GetNumGrps();
     int num_angles = angleset->angles.size();
 
     //============================ Resize FLUDS local outgoing Data
-    angleset->local_psi.resize(fluds->num_face_categories);
-    // fc = face category
-    for (size_t fc = 0; fc<fluds->num_face_categories; fc++)
+    if (angleset->single_precision_psi)
+    {
+      angleset->local_psi_f.resize(fluds->num_face_categories);
+      for (size_t fc = 0; fc<fluds->num_face_categories; fc++)
+      {
+        angleset->local_psi_f[fc].resize(fluds->local_psi_stride[fc]*
+                                         fluds->local_psi_max_elements[fc]*
+                                         num_grps*num_angles,0.0f);
+      }
+    }
+    else
     {
-      angleset->local_psi[fc].resize(fluds->local_psi_stride[fc]*
-                                     fluds->local_psi_max_elements[fc]*
-                                     num_grps*num_angles,0.0);
+      angleset->local_psi.resize(fluds->num_face_categories);
+      // fc = face category
+      for (size_t fc = 0; fc<fluds->num_face_categories; fc++)
+      {
+        angleset->local_psi[fc].resize(fluds->local_psi_stride[fc]*
+                                       fluds->local_psi_max_elements[fc]*
+                                       num_grps*num_angles,0.0);
+      }
     }
 
     //============================ Resize FLUDS non-local outgoing Data
+    //Each successor gets either a float or a double buffer, the other
+    //one stays empty. Delayed successors always use the double buffer.
+    size_t num_successors = spds->location_successors.size();
     angleset->deplocI_outgoing_psi.resize(
-      spds->location_successors.size(),std::vector<double>());
-    for (size_t deplocI=0; deplocI<spds->location_successors.size(); deplocI++)
+      num_successors,std::vector<double>());
+    if (angleset->single_precision_psi)
+      angleset->deplocI_outgoing_psi_f.resize(num_successors);
+    for (size_t deplocI=0; deplocI<num_successors; deplocI++)
     {
-      angleset->deplocI_outgoing_psi[deplocI].resize(
-        fluds->deplocI_face_dof_count[deplocI]*num_grps*num_angles,0.0);
+      size_t buff_size =
+        fluds->deplocI_face_dof_count[deplocI]*num_grps*num_angles;
+
+      if (deplocI_single_precision[deplocI])
+        angleset->deplocI_outgoing_psi_f[deplocI].resize(buff_size,0.0f);
+      else
+        angleset->deplocI_outgoing_psi[deplocI].resize(buff_size,0.0);
     }
 
     //================================================ Make a memory query
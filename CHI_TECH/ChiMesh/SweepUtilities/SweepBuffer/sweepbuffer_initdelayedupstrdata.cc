@@ -16,6 +16,25 @@ InitializeDelayedUpstreamData()
   int num_grps   = angleset->GetNumGrps();
   int num_angles = angleset->angles.size();
 
+  //The delayed receive buffers are reallocated so the persistent
+  //receives bound to them have to be recreated. Receives still active
+  //from the last sweep are completed first.
+  int finalized = 0;
+  MPI_Finalized(&finalized);
+  if (!finalized)
+  {
+    if (delayed_recv_requests_started)
+      MPI_Waitall(delayed_prelocI_recv_request.size(),
+                  delayed_prelocI_recv_request.data(),
+                  MPI_STATUSES_IGNORE);
+    for (auto& request : delayed_prelocI_recv_request)
+      MPI_Request_free(&request);
+  }
+  delayed_prelocI_recv_request.clear();
+  delayed_recv_requests_initialized = false;
+  delayed_recv_requests_started = false;
+  delayed_data_pending = false;
+
   angleset->delayed_prelocI_outgoing_psi.clear();
   angleset->delayed_prelocI_outgoing_psi.resize(
     spds->delayed_location_dependencies.size());
@@ -0,0 +1,105 @@
+#include "sweepbuffer.h"
+
+#include "ChiMesh/SweepUtilities/AngleSet/angleset.h"
+#include "ChiMesh/SweepUtilities/SPDS/SPDS.h"
+
+//###################################################################
+/**Appends copies of the active upstream receive requests and, if
+ * requested, the active downstream send requests to the given list so
+ * that a scheduler can block on them. The request ids identify the
+ * requests in calls to CompleteRequest. Receive ids index the
+ * persistent receives, send ids follow them and run over all the
+ * deplocI messages. While the delayed data of the previous sweep is
+ * pending its receives are appended last.*/
+void chi_mesh::sweep_management::SweepBuffer::
+  GetPendingRequests(std::vector<MPI_Request>& requests,
+                     std::vector<int>& request_ids,
+                     bool include_sends)
+{
+  //============================================= Upstream receives
+  if (upstream_data_initialized and num_pending_recvs > 0)
+  {
+    for (size_t k=0; k<prelocI_recv_request.size(); k++)
+    {
+      const auto& prelocI_m = prelocI_recv_request_map[k];
+      if (!prelocI_message_available[prelocI_m.first][prelocI_m.second])
+      {
+        requests.push_back(prelocI_recv_request[k]);
+        request_ids.push_back(k);
+      }
+    }
+  }
+
+  //============================================= Downstream sends
+  if (include_sends and !done_sending)
+  {
+    int request_id = prelocI_recv_request.size();
+    for (auto& deplocI_requests : deplocI_message_request)
+    {
+      for (auto& request : deplocI_requests)
+      {
+        if (request != MPI_REQUEST_NULL)
+        {
+          requests.push_back(request);
+          request_ids.push_back(request_id);
+        }
+        ++request_id;
+      }
+    }
+  }
+
+  //============================================= Delayed receives
+  if (delayed_data_pending and delayed_recv_requests_started)
+  {
+    int request_id = prelocI_recv_request.size() + NumSendRequests();
+    for (auto& request : delayed_prelocI_recv_request)
+    {
+      requests.push_back(request);
+      request_ids.push_back(request_id++);
+    }
+  }
+}
+
+//###################################################################
+/**Records the completion of a request obtained from
+ * GetPendingRequests and completed by the caller.*/
+void chi_mesh::sweep_management::SweepBuffer::CompleteRequest(int request_id)
+{
+  //============================================= Upstream receive
+  int num_recv_requests = prelocI_recv_request.size();
+  if (request_id < num_recv_requests)
+  {
+    const auto& prelocI_m = prelocI_recv_request_map[request_id];
+    prelocI_message_available[prelocI_m.first][prelocI_m.second] = true;
+    --num_pending_recvs;
+    return;
+  }
+
+  //============================================= Delayed receive
+  //The persistent request is inactive now, ReceiveUpstreamPsi will
+  //find it completed
+  int flat_index = request_id - num_recv_requests;
+  if (flat_index >= NumSendRequests()) return;
+
+  //============================================= Downstream send
+  //The request has been freed by the completing call
+  for (auto& deplocI_requests : deplocI_message_request)
+  {
+    if (flat_index < deplocI_requests.size())
+    {
+      deplocI_requests[flat_index] = MPI_REQUEST_NULL;
+      return;
+    }
+    flat_index -= deplocI_requests.size();
+  }
+}
+
+//###################################################################
+/**Returns the number of downstream send requests over all deplocI.*/
+int chi_mesh::sweep_management::SweepBuffer::NumSendRequests()
+{
+  int num_requests = 0;
+  for (auto& deplocI_requests : deplocI_message_request)
+    num_requests += deplocI_requests.size();
+  return num_requests;
+}
@@ -0,0 +1,179 @@
+#include "sweepbuffer.h"
+
+#include "ChiMesh/SweepUtilities/AngleSet/angleset.h"
+#include "ChiMesh/SweepUtilities/SPDS/SPDS.h"
+#include "ChiMesh/SweepUtilities/FLUDS/FLUDS.h"
+
+//###################################################################
+/**Allocates the upstream receive buffers and creates a persistent
+ * receive for every upstream and delayed-upstream message. Because the
+ * requests are bound to the buffer addresses, the receive buffers are
+ * kept allocated for the lifetime of the sweep buffer.*/
+void chi_mesh::sweep_management::SweepBuffer::
+  InitializePersistentReceives(int angle_set_num)
+{
+  auto  spds =  angleset->GetSPDS();
+  auto fluds =  angleset->fluds;
+
+  int num_grps   = angleset->GetNumGrps();
+  int num_angles = angleset->angles.size();
+
+  const bool single_precision = angleset->single_precision_psi;
+  MPI_Comm   comm = comm_set->comm;
+
+  //============================================= Upstream messages
+  if (!recv_requests_initialized)
+  {
+    size_t num_dependencies = spds->location_dependencies.size();
+    if (single_precision)
+    {
+      angleset->prelocI_outgoing_psi_f.resize(num_dependencies);
+      for (size_t prelocI=0; prelocI<num_dependencies; prelocI++)
+        angleset->prelocI_outgoing_psi_f[prelocI].resize(
+          fluds->prelocI_face_dof_count[prelocI]*num_grps*num_angles,0.0f);
+    }
+    else
+    {
+      angleset->prelocI_outgoing_psi.resize(num_dependencies);
+      for (size_t prelocI=0; prelocI<num_dependencies; prelocI++)
+        angleset->prelocI_outgoing_psi[prelocI].resize(
+          fluds->prelocI_face_dof_count[prelocI]*num_grps*num_angles,0.0);
+    }
+
+    prelocI_recv_request.clear();
+    prelocI_recv_request_map.clear();
+    for (size_t prelocI=0; prelocI<num_dependencies; prelocI++)
+    {
+      int locJ = spds->location_dependencies[prelocI];
+
+      for (int m=0; m<prelocI_message_count[prelocI]; m++)
+      {
+        u_ll_int block_addr   = prelocI_message_blockpos[prelocI][m];
+        u_ll_int message_size = prelocI_message_size[prelocI][m];
+
+        void* recv_buffer = (single_precision)?
+          (void*)&angleset->prelocI_outgoing_psi_f[prelocI].data()[block_addr] :
+          (void*)&angleset->prelocI_outgoing_psi[prelocI].data()[block_addr];
+
+        MPI_Request request;
+        MPI_Recv_init(recv_buffer,
+                      message_size,
+                      (single_precision)? MPI_FLOAT : MPI_DOUBLE,
+                      locJ,
+                      max_num_mess*angle_set_num + m, //tag
+                      comm,
+                      &request);
+
+        prelocI_recv_request.push_back(request);
+        prelocI_recv_request_map.emplace_back(prelocI,m);
+      }
+    }
+    recv_completed_indices.resize(prelocI_recv_request.size());
+
+    recv_requests_initialized = true;
+  }
+
+  //============================================= Delayed upstream messages
+  if (!delayed_recv_requests_initialized)
+  {
+    delayed_prelocI_recv_request.clear();
+    for (size_t prelocI=0;
+         prelocI<spds->delayed_location_dependencies.size(); prelocI++)
+    {
+      int locJ = spds->delayed_location_dependencies[prelocI];
+
+      for (int m=0; m<delayed_prelocI_message_count[prelocI]; m++)
+      {
+        u_ll_int block_addr   = delayed_prelocI_message_blockpos[prelocI][m];
+        u_ll_int message_size = delayed_prelocI_message_size[prelocI][m];
+
+        MPI_Request request;
+        MPI_Recv_init(
+          &angleset->delayed_prelocI_outgoing_psi[prelocI].data()[block_addr],
+          message_size,
+          MPI_DOUBLE,
+          locJ,
+          max_num_mess*angle_set_num + m, //tag
+          comm,
+          &request);
+
+        delayed_prelocI_recv_request.push_back(request);
+      }
+    }
+
+    delayed_recv_requests_initialized = true;
+  }
+}
+
+//###################################################################
+/**Starts the persistent receives of a sweep. The upstream receives are
+ * not started when the upstream psi arrives through a message
+ * aggregator. The delayed receives complete in ReceiveDelayedData,
+ * at the latest when the next sweep reaches this angle set.*/
+void chi_mesh::sweep_management::SweepBuffer::
+  StartPersistentReceives(bool start_upstream)
+{
+  num_pending_recvs = 0;
+  if (start_upstream and !prelocI_recv_request.empty())
+  {
+    num_pending_recvs = prelocI_recv_request.size();
+    MPI_Startall(prelocI_recv_request.size(),prelocI_recv_request.data());
+  }
+
+  if (!delayed_prelocI_recv_request.empty() and !delayed_recv_requests_started)
+  {
+    //Keep the current values for the change norms of ReceiveDelayedData
+    delayed_prelocI_psi_prev = angleset->delayed_prelocI_outgoing_psi;
+
+    MPI_Startall(delayed_prelocI_recv_request.size(),
+                 delayed_prelocI_recv_request.data());
+    delayed_recv_requests_started = true;
+  }
+}
+
+//###################################################################
+/**Tests whether the delayed receives of the previous sweep have
+ * completed. Returns true if no delayed receives are active.*/
+bool chi_mesh::sweep_management::SweepBuffer::TestDelayedReceives()
+{
+  if (!delayed_recv_requests_started) return true;
+
+  int completed = 0;
+  MPI_Testall(delayed_prelocI_recv_request.size(),
+              delayed_prelocI_recv_request.data(),
+              &completed,
+              MPI_STATUSES_IGNORE);
+
+  return completed != 0;
+}
+
+//###################################################################
+/**Frees all persistent receives. The upstream requests must be
+ * inactive, active delayed receives of the last sweep are completed
+ * first.*/
+void chi_mesh::sweep_management::SweepBuffer::FreePersistentReceives()
+{
+  int finalized = 0;
+  MPI_Finalized(&finalized);
+  if (finalized) return;
+
+  if (delayed_recv_requests_started)
+  {
+    MPI_Waitall(delayed_prelocI_recv_request.size(),
+                delayed_prelocI_recv_request.data(),
+                MPI_STATUSES_IGNORE);
+    delayed_recv_requests_started = false;
+  }
+
+  for (auto& request : prelocI_recv_request)
+    MPI_Request_free(&request);
+  prelocI_recv_request.clear();
+  prelocI_recv_request_map.clear();
+
+  for (auto& request : delayed_prelocI_recv_request)
+    MPI_Request_free(&request);
+  delayed_prelocI_recv_request.clear();
+
+  recv_requests_initialized = false;
+  delayed_recv_requests_initialized = false;
+}
@@ -0,0 +1,60 @@
+#include "sweepbuffer.h"
+
+#include "ChiMesh/SweepUtilities/AngleSet/angleset.h"
+#include "ChiMesh/SweepUtilities/SPDS/SPDS.h"
+
+#include <cstring>
+
+#include <chi_log.h>
+extern ChiLog     chi_log;
+
+//###################################################################
+/**Copies the upstream psi of location locJ, as unpacked from an
+ * aggregate message, into the receive buffer. Returns false, without
+ * copying, if the data from this location has already been received
+ * during the current sweep.*/
+bool chi_mesh::sweep_management::SweepBuffer::
+  ReceiveAggregatedPsi(int angle_set_num, int locJ,
+                       const char* data, u_ll_int num_bytes)
+{
+  auto spds = angleset->GetSPDS();
+
+  //Allocates the receive buffers if this angle set has not yet been
+  //advanced during a sweep
+  InitializePersistentReceives(angle_set_num);
+
+  int prelocI = spds->MapLocJToPrelocI(locJ);
+  if (prelocI < 0)
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "SweepBuffer: Aggregated psi received from delayed dependency "
+      << locJ << ".";
+    exit(EXIT_FAILURE);
+  }
+
+  auto& available = prelocI_message_available[prelocI];
+  for (bool message_available : available)
+    if (message_available) return false;
+
+  const bool single_precision = angleset->single_precision_psi;
+  void* recv_buffer = (single_precision)?
+    (void*)angleset->prelocI_outgoing_psi_f[prelocI].data() :
+    (void*)angleset->prelocI_outgoing_psi[prelocI].data();
+  u_ll_int buffer_bytes = (single_precision)?
+    angleset->prelocI_outgoing_psi_f[prelocI].size()*sizeof(float) :
+    angleset->prelocI_outgoing_psi[prelocI].size()*sizeof(double);
+
+  if (num_bytes != buffer_bytes)
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "SweepBuffer: Aggregated psi size mismatch. as_num="
+      << angle_set_num << " locJ=" << locJ
+      << " expected=" << buffer_bytes << " received=" << num_bytes;
+    exit(EXIT_FAILURE);
+  }
+
+  std::memcpy(recv_buffer, data, num_bytes);
+  available.assign(available.size(),true);
+
+  return true;
+}
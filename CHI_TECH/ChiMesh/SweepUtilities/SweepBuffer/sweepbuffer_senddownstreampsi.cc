@@ -2,10 +2,14 @@
 
 #include "ChiMesh/SweepUtilities/AngleSet/angleset.h"
 #include "ChiMesh/SweepUtilities/SPDS/SPDS.h"
+#include "sweep_msgaggregator.h"
+
+#include <algorithm>
 
 //###################################################################
 /**Sends downstream psi. This method gets called after a sweep chunk has
- * executed */
+ * executed. With a message aggregator the psi of non-delayed successors
+ * is queued on the aggregator instead of being sent directly.*/
 void chi_mesh::sweep_management::SweepBuffer::
 SendDownstreamPsi(int angle_set_num)
 {
@@ -15,18 +19,46 @@ SendDownstreamPsi(int angle_set_num)
   {
     int locJ = spds->location_successors[deplocI];
 
+    //Delayed successors receive double precision psi
+    const bool single_precision = deplocI_single_precision[deplocI];
+
     int num_mess = deplocI_message_count[deplocI];
+
+    //=============================== Aggregated
+    const auto& delayed_successors = spds->delayed_location_successors;
+    if (msg_aggregator != nullptr and num_mess > 0 and
+        std::find(delayed_successors.begin(),delayed_successors.end(),locJ) ==
+        delayed_successors.end())
+    {
+      const void* psi = (single_precision)?
+        (void*)angleset->deplocI_outgoing_psi_f[deplocI].data() :
+        (void*)angleset->deplocI_outgoing_psi[deplocI].data();
+      u_ll_int num_bytes = (single_precision)?
+        angleset->deplocI_outgoing_psi_f[deplocI].size()*sizeof(float) :
+        angleset->deplocI_outgoing_psi[deplocI].size()*sizeof(double);
+
+      msg_aggregator->Queue(locJ, angle_set_num, psi, num_bytes);
+
+      for (auto& request : deplocI_message_request[deplocI])
+        request = MPI_REQUEST_NULL;
+      continue;
+    }
+
     for (int m=0; m<num_mess; m++)
     {
       u_ll_int block_addr   = deplocI_message_blockpos[deplocI][m];
       u_ll_int message_size = deplocI_message_size[deplocI][m];
 
-      MPI_Isend(&angleset->deplocI_outgoing_psi[deplocI].data()[block_addr],
+      void* send_buffer = (single_precision)?
+        (void*)&angleset->deplocI_outgoing_psi_f[deplocI].data()[block_addr] :
+        (void*)&angleset->deplocI_outgoing_psi[deplocI].data()[block_addr];
+
+      MPI_Isend(send_buffer,
                 message_size,
-                MPI_DOUBLE,
-                comm_set->MapIonJ(locJ,locJ),
+                (single_precision)? MPI_FLOAT : MPI_DOUBLE,
+                locJ,
                 max_num_mess*angle_set_num + m, //tag
-                comm_set->communicators[locJ],
+                comm_set->comm,
                 &deplocI_message_request[deplocI][m]);
     }//for message
   }//for deplocI
@@ -0,0 +1,141 @@
+#include "sweep_threadpool.h"
+
+#include <algorithm>
+
+//###################################################################
+/**Starts the worker threads.*/
+chi_mesh::sweep_management::SweepThreadPool::
+  SweepThreadPool(int num_threads) :
+  num_queued(0),
+  stop(false),
+  next_queue(0)
+{
+  if (num_threads < 1) num_threads = 1;
+
+  for (int t=0; t<num_threads; t++)
+    queues.emplace_back(new WorkerQueue);
+
+  for (int t=0; t<num_threads; t++)
+    workers.emplace_back(&SweepThreadPool::WorkerLoop, this, t);
+}
+
+//###################################################################
+/**Lets the workers finish all queued tasks and joins them.*/
+chi_mesh::sweep_management::SweepThreadPool::~SweepThreadPool()
+{
+  {
+    std::lock_guard<std::mutex> lock(sleep_mutex);
+    stop = true;
+  }
+  sleep_cv.notify_all();
+
+  for (auto& worker : workers)
+    worker.join();
+}
+
+//###################################################################
+/**Queues a task on the next worker in round-robin order.*/
+void chi_mesh::sweep_management::SweepThreadPool::Submit(Task task)
+{
+  WorkerQueue& queue = *queues[next_queue];
+  next_queue = (next_queue + 1) % queues.size();
+
+  {
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    queue.tasks.push_back(std::move(task));
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(sleep_mutex);
+    num_queued++;
+  }
+  sleep_cv.notify_one();
+}
+
+//###################################################################
+/**Splits [0,num_items) into contiguous ranges and calls
+ * range_func(thread_id,begin,end) for each of them. The ranges are
+ * executed by the workers and by the calling thread, which uses
+ * thread_id = NumThreads(). Returns once all ranges are done. Only one
+ * thread at a time may submit work to a pool.*/
+void chi_mesh::sweep_management::SweepThreadPool::
+  ParallelFor(int num_items, const std::function<void(int,int,int)>& range_func)
+{
+  if (num_items <= 0) return;
+
+  const int num_parts = std::min(num_items, NumThreads()+1);
+  std::atomic<int> num_remaining(num_parts-1);
+
+  for (int p=1; p<num_parts; p++)
+  {
+    int begin = static_cast<int>((static_cast<long>(num_items)*p)/num_parts);
+    int end   = static_cast<int>((static_cast<long>(num_items)*(p+1))/num_parts);
+    Submit([&range_func,&num_remaining,begin,end](int worker_id)
+    {
+      range_func(worker_id,begin,end);
+      num_remaining--;
+    });
+  }
+
+  range_func(NumThreads(), 0, num_items/num_parts);
+
+  while (num_remaining > 0)
+    std::this_thread::yield();
+}
+
+//###################################################################
+/**Takes a task from the worker's own deque or, failing that, steals
+ * one from another worker.*/
+bool chi_mesh::sweep_management::SweepThreadPool::
+  PopTask(int worker_id, Task& task)
+{
+  const size_t num_queues = queues.size();
+
+  //=================================== Own queue, front
+  {
+    WorkerQueue& queue = *queues[worker_id];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (not queue.tasks.empty())
+    {
+      task = std::move(queue.tasks.front());
+      queue.tasks.pop_front();
+      num_queued--;
+      return true;
+    }
+  }
+
+  //=================================== Steal, back
+  for (size_t k=1; k<num_queues; k++)
+  {
+    WorkerQueue& queue = *queues[(worker_id + k) % num_queues];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (not queue.tasks.empty())
+    {
+      task = std::move(queue.tasks.back());
+      queue.tasks.pop_back();
+      num_queued--;
+      return true;
+    }
+  }
+
+  return false;
+}
+
+//###################################################################
+/**Main loop of a worker thread.*/
+void chi_mesh::sweep_management::SweepThreadPool::WorkerLoop(int worker_id)
+{
+  Task task;
+  while (true)
+  {
+    if (PopTask(worker_id, task))
+    {
+      task(worker_id);
+      continue;
+    }
+
+    std::unique_lock<std::mutex> lock(sleep_mutex);
+    sleep_cv.wait(lock, [this]{return stop or num_queued > 0;});
+    if (stop and num_queued == 0) break;
+  }
+}
@@ -0,0 +1,66 @@
+#ifndef _chi_sweep_threadpool_h
+#define _chi_sweep_threadpool_h
+
+#include <vector>
+#include <deque>
+#include <memory>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+
+namespace chi_mesh::sweep_management
+{
+
+//###################################################################
+/**Work-stealing thread pool used to execute the sweep chunks of
+ * several angle sets concurrently. Every worker owns a task deque.
+ * Tasks are distributed round-robin by the submitting thread, workers
+ * pop from the front of their own deque and, when it is empty, steal
+ * from the back of the other deques. Tasks receive the id of the
+ * worker executing them so that per-worker scratch can be used.
+ *
+ * Workers never call MPI; all communication stays on the submitting
+ * thread.*/
+class SweepThreadPool
+{
+public:
+  typedef std::function<void(int)> Task;
+
+private:
+  struct WorkerQueue
+  {
+    std::mutex       mutex;
+    std::deque<Task> tasks;
+  };
+
+  std::vector<std::unique_ptr<WorkerQueue>> queues;
+  std::vector<std::thread>                  workers;
+
+  std::mutex               sleep_mutex;
+  std::condition_variable  sleep_cv;
+  std::atomic<int>         num_queued;
+  bool                     stop;
+  size_t                   next_queue;
+
+public:
+  explicit SweepThreadPool(int num_threads);
+  ~SweepThreadPool();
+
+  SweepThreadPool(const SweepThreadPool&) = delete;
+  SweepThreadPool& operator=(const SweepThreadPool&) = delete;
+
+  int  NumThreads() const {return static_cast<int>(workers.size());}
+  void Submit(Task task);
+  void ParallelFor(int num_items,
+                   const std::function<void(int,int,int)>& range_func);
+
+private:
+  bool PopTask(int worker_id, Task& task);
+  void WorkerLoop(int worker_id);
+};
+
+}
+
+#endif
@@ -3,13 +3,24 @@
 
 #include "ChiMesh/SweepUtilities/AngleAggregation/angleaggregation.h"
 #include "ChiMesh/SweepUtilities/sweepchunk_base.h"
+#include "sweep_threadpool.h"
+#include "ChiMesh/SweepUtilities/SweepBuffer/sweep_msgaggregator.h"
+
+#include <mutex>
+#include <condition_variable>
 
 
 namespace chi_mesh::sweep_management
 {
+  /**Sweep scheduling algorithms. All but FIRST_IN_FIRST_OUT execute
+   * every ready angle set in each pass over the angle sets and differ
+   * only in the priority order of that pass.*/
   enum class SchedulingAlgorithm {
-    FIRST_IN_FIRST_OUT = 1,
-    DEPTH_OF_GRAPH = 2
+    FIRST_IN_FIRST_OUT = 1, ///< Angle set groups in order, one at a time
+    DEPTH_OF_GRAPH = 2,     ///< Depth of location in the global graph
+    BOTTOM_LEVEL = 3,       ///< Heaviest remaining downstream path (b-level)
+    MOST_SUCCESSORS = 4,    ///< Number of dependent locations
+    EAGER_THEN_DEPTH = 5    ///< Feeding other locations first, then depth
   };
 }
 
@@ -35,24 +46,65 @@ private:
     int        sign_of_omegay;
     int        sign_of_omegaz;
     size_t     set_index;
+    long long  bottom_level;
+    int        num_successors;
 
     explicit RULE_VALUES(TAngleSet* ref_as) :
       angle_set(ref_as)
     {
       depth_of_graph = 0;
       set_index      = 0;
+      bottom_level   = 0;
+      num_successors = 0;
       sign_of_omegax = 1;
       sign_of_omegay = 1;
       sign_of_omegaz = 1;
     }
   };
   std::vector<RULE_VALUES> rule_values;
+  bool                     bottom_levels_computed;
+
+  //Threaded execution of angle sets
+  int                              num_threads;
+  SweepThreadPool*                 thread_pool;
+  std::vector<SweepChunk*>         thread_chunks;
+  std::vector<std::vector<double>> thread_phi;
+  std::mutex                       completed_mutex;
+  std::condition_variable          completed_cv;
+  std::vector<size_t>              completed_rules;
+
+  //Event-driven waiting
+  bool                             event_driven;
+  std::vector<MPI_Request>         event_requests;
+  std::vector<int>                 event_request_ids;
+  std::vector<size_t>              event_request_rules;
+  std::vector<int>                 event_completed_indices;
+
+  //Tracing and logging
+  size_t                           trace_sweep_id;
+  size_t                           trace_angleset_id;
+  size_t                           trace_wait_id;
+  bool                             log_angleset_events;
+
+  //Aggregation of downstream messages
+  int                              max_num_messages;
+  SweepMessageAggregator*          msg_aggregator;
 public:
   const size_t sweep_event_tag;
   const std::vector<size_t> sweep_timing_events_tag;
 public:
   SweepScheduler(SchedulingAlgorithm in_scheduler_type,
                  AngleAggregation* in_angle_agg);
+  ~SweepScheduler();
+
+  void SetNumberOfThreads(int in_num_threads);
+  void SetMessageAggregation(ChiMPICommunicatorSet* comm_set);
+  void SetEventDriven(bool in_event_driven);
+  void SetLogAngleSetEvents(bool log_events);
+
+  void SetSchedulingAlgorithm(SchedulingAlgorithm in_scheduler_type);
+  std::string CompareSchedulingAlgorithms(SweepChunk* in_sweep_chunk,
+                                          int num_sweeps);
 
   void Sweep(SweepChunk* in_sweep_chunk=NULL);
   double GetAverageSweepTime();
@@ -64,6 +116,20 @@ private:
   //02
   void InitializeAlgoDOG();
   void ScheduleAlgoDOG();
+  void ComputeBottomLevels();
+  void SortRuleValues();
+
+  //03
+  bool InitializeThreadedSweep();
+  void FinalizeThreadedSweep();
+  void ScheduleAlgoDOGThreaded();
+
+  void ProgressAggregatedMessages();
+
+  //04
+  void WaitForEvents(bool receiving);
+
+  void LogAngleSetEvent(int angle_set_num, const char* action);
 };
 
 #endif
\ No newline at end of file
@@ -1,9 +1,13 @@
 #include "sweepscheduler.h"
 
+#include <chi_mpi.h>
 #include <chi_log.h>
 
+extern ChiMPI chi_mpi;
 extern ChiLog chi_log;
 
+#include <sstream>
+
 //###################################################################
 /**Sweep scheduler constructor*/
 chi_mesh::sweep_management::SweepScheduler::SweepScheduler(
@@ -16,11 +20,25 @@ chi_mesh::sweep_management::SweepScheduler::SweepScheduler(
 {
   scheduler_type = in_scheduler_type;
   angle_agg      = in_angle_agg;
+  sweep_chunk    = nullptr;
+
+  num_threads    = 1;
+  thread_pool    = nullptr;
+
+  max_num_messages = 0;
+  msg_aggregator   = nullptr;
+
+  event_driven     = false;
+
+  trace_sweep_id      = chi_log.tracer.RegisterEvent("Sweep");
+  trace_angleset_id   = chi_log.tracer.RegisterEvent("AngleSetExecute");
+  trace_wait_id       = chi_log.tracer.RegisterEvent("SweepWait");
+  log_angleset_events = false;
 
   angle_agg->InitializeReflectingBCs();
 
-  if (scheduler_type == SchedulingAlgorithm::DEPTH_OF_GRAPH)
-    InitializeAlgoDOG();
+  bottom_levels_computed = false;
+  InitializeAlgoDOG();
 
   //=================================== Initialize delayed upstream data
   for (auto angsetgrp : in_angle_agg->angle_set_groups)
@@ -51,4 +69,124 @@ chi_mesh::sweep_management::SweepScheduler::SweepScheduler(
   for (auto angsetgrp : in_angle_agg->angle_set_groups)
     for (auto angset : angsetgrp->angle_sets)
       angset->SetMaxBufferMessages(global_max_num_messages);
-}
\ No newline at end of file
+
+  max_num_messages = global_max_num_messages;
+}
+
+//###################################################################
+/**Sweep scheduler destructor*/
+chi_mesh::sweep_management::SweepScheduler::~SweepScheduler()
+{
+  SetMessageAggregation(nullptr);
+  delete thread_pool;
+}
+
+//###################################################################
+/**Sets the number of threads used to execute ready angle sets
+ * concurrently. With more than one thread the Depth-Of-Graph
+ * scheduler hands angle sets to a pool of workers while the calling
+ * thread performs all the communication.*/
+void chi_mesh::sweep_management::SweepScheduler::
+  SetNumberOfThreads(int in_num_threads)
+{
+  if (in_num_threads < 1)
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "SweepScheduler: Number of threads must be at least 1.";
+    exit(EXIT_FAILURE);
+  }
+
+  num_threads = in_num_threads;
+
+  delete thread_pool;
+  thread_pool = nullptr;
+
+  if (num_threads > 1)
+    thread_pool = new SweepThreadPool(num_threads);
+}
+
+//###################################################################
+/**Sets whether the execution of every angle set is logged as a string
+ * event on the sweep timing event, e.g. for a sweep log file. This is
+ * costly and off by default, the ChiLog tracer records the same
+ * information in compact form when enabled.*/
+void chi_mesh::sweep_management::SweepScheduler::
+  SetLogAngleSetEvents(bool log_events)
+{
+  log_angleset_events = log_events;
+}
+
+//###################################################################
+/**Logs the given action of an angle set on the sweep timing event.*/
+void chi_mesh::sweep_management::SweepScheduler::
+  LogAngleSetEvent(int angle_set_num, const char* action)
+{
+  std::stringstream message;
+  message
+    << "Angleset " << angle_set_num
+    << " " << action << " on location " << chi_mpi.location_id;
+
+  auto ev_info = std::make_shared<ChiLog::EventInfo>(message.str());
+
+  chi_log.LogEvent(sweep_event_tag,
+                   ChiLog::EventType::SINGLE_OCCURRENCE,ev_info);
+}
+
+//###################################################################
+/**Enables the aggregation of downstream messages over the given
+ * communicator set. The outgoing psi of all the angle sets that
+ * complete during one pass of the scheduler is sent as a single
+ * message per downstream location. Passing a null pointer restores
+ * the per-angle-set messages.*/
+void chi_mesh::sweep_management::SweepScheduler::
+  SetMessageAggregation(ChiMPICommunicatorSet* comm_set)
+{
+  //=================================== Detach existing aggregator
+  if (msg_aggregator != nullptr)
+  {
+    for (auto angsetgrp : angle_agg->angle_set_groups)
+      for (auto angset : angsetgrp->angle_sets)
+        angset->SetMessageAggregator(nullptr);
+
+    delete msg_aggregator;
+    msg_aggregator = nullptr;
+  }
+
+  if (comm_set == nullptr) return;
+
+  //=================================== Map angle set numbers
+  //Angle set numbers are as + q*num_anglesets for all schedulers
+  std::vector<TAngleSet*> angle_sets;
+  for (size_t q=0; q<angle_agg->angle_set_groups.size(); q++)
+  {
+    auto& group_angle_sets = angle_agg->angle_set_groups[q]->angle_sets;
+    size_t num_anglesets = group_angle_sets.size();
+    for (size_t as=0; as<num_anglesets; as++)
+    {
+      size_t set_index = as + q * num_anglesets;
+      if (set_index >= angle_sets.size())
+        angle_sets.resize(set_index+1, nullptr);
+      angle_sets[set_index] = group_angle_sets[as];
+    }
+  }
+
+  //=================================== Create aggregator
+  //The tag follows the largest tag of the per-angle-set messages
+  int tag = max_num_messages*static_cast<int>(angle_sets.size());
+
+  msg_aggregator = new SweepMessageAggregator(comm_set, tag, angle_sets);
+
+  for (auto angset : angle_sets)
+    if (angset != nullptr) angset->SetMessageAggregator(msg_aggregator);
+}
+
+//###################################################################
+/**Sends the messages aggregated during a scheduler pass and receives
+ * the aggregates that have arrived. Does nothing without aggregation.*/
+void chi_mesh::sweep_management::SweepScheduler::ProgressAggregatedMessages()
+{
+  if (msg_aggregator == nullptr) return;
+
+  msg_aggregator->Flush();
+  msg_aggregator->Receive();
+}
@@ -9,7 +9,10 @@ extern ChiLog chi_log;
 #include <sstream>
 
 //###################################################################
-/**Initializes the Depth-Of-Graph algorithm.*/
+/**Initializes the rule values of all angle sets and sorts them
+ * according to the scheduling algorithm. The rule values are built for
+ * all algorithms since they are also used to receive the delayed data
+ * after a sweep.*/
 void chi_mesh::sweep_management::SweepScheduler::InitializeAlgoDOG()
 {
   //================================================== Load all anglesets
@@ -29,7 +32,7 @@ void chi_mesh::sweep_management::SweepScheduler::InitializeAlgoDOG()
       TLEVELED_GRAPH& leveled_graph = spds->global_sweep_planes;
 
       //========================== Find location depth
-      size_t loc_depth = -1;
+      int loc_depth = -1;
       for (size_t level=0; level<leveled_graph.size(); level++)
       {
         for (size_t index=0; index<leveled_graph[level]->item_id.size(); index++)
@@ -53,6 +56,10 @@ void chi_mesh::sweep_management::SweepScheduler::InitializeAlgoDOG()
         new_rule_vals.sign_of_omegay = (spds->omega.y >= 0)?2:1;
         new_rule_vals.sign_of_omegaz = (spds->omega.z >= 0)?2:1;
 
+        new_rule_vals.num_successors =
+          spds->location_successors.size() -
+          spds->delayed_location_successors.size();
+
         rule_values.push_back(new_rule_vals);
       }
       else
@@ -65,51 +72,10 @@ void chi_mesh::sweep_management::SweepScheduler::InitializeAlgoDOG()
     }//for anglesets
   }//for quadrants/anglesetgroups
 
-  //================================================== Init sort functions
-  struct
-  {
-    bool operator()(RULE_VALUES a, RULE_VALUES b)
-    {
-      return a.depth_of_graph > b.depth_of_graph;
-    }
-  }compare_D;
-
-  struct
-  {
-    bool operator()(RULE_VALUES a, RULE_VALUES b)
-    {
-      return (a.depth_of_graph == b.depth_of_graph) and
-             (a.sign_of_omegax > b.sign_of_omegax);
-    }
-  }compare_omega_x;
-
-  struct
-  {
-    bool operator()(RULE_VALUES a, RULE_VALUES b)
-    {
-      return (a.depth_of_graph == b.depth_of_graph) and
-             (a.sign_of_omegax == b.sign_of_omegax) and
-             (a.sign_of_omegay > b.sign_of_omegay);
-    }
-  }compare_omega_y;
-
-  struct
-  {
-    bool operator()(RULE_VALUES a, RULE_VALUES b)
-    {
-      return (a.depth_of_graph == b.depth_of_graph) and
-             (a.sign_of_omegax == b.sign_of_omegax) and
-             (a.sign_of_omegay == b.sign_of_omegay) and
-             (a.sign_of_omegaz > b.sign_of_omegaz);
-    }
-  }compare_omega_z;
-
-  //================================================== Sort
-  std::stable_sort(rule_values.begin(),rule_values.end(),compare_D);
-  std::stable_sort(rule_values.begin(),rule_values.end(),compare_omega_x);
-  std::stable_sort(rule_values.begin(),rule_values.end(),compare_omega_y);
-  std::stable_sort(rule_values.begin(),rule_values.end(),compare_omega_z);
+  if (scheduler_type == SchedulingAlgorithm::BOTTOM_LEVEL)
+    ComputeBottomLevels();
 
+  SortRuleValues();
 }
 
 //###################################################################
@@ -126,6 +92,7 @@ void chi_mesh::sweep_management::SweepScheduler::ScheduleAlgoDOG()
 
   chi_log.LogEvent(sweep_event_tag,
                    ChiLog::EventType::SINGLE_OCCURRENCE,ev_info);
+  chi_log.tracer.Trace(trace_sweep_id,ChiTracer::Phase::BEGIN);
 
   //==================================================== Loop till done
   bool finished = false;
@@ -133,6 +100,9 @@ void chi_mesh::sweep_management::SweepScheduler::ScheduleAlgoDOG()
   while (!finished)
   {
     finished = true;
+    bool progressed = false;
+    bool receiving  = false;
+    ProgressAggregatedMessages();
     for (size_t as=0; as<rule_values.size(); as++)
     {
       TAngleSet* angleset = rule_values[as].angle_set;
@@ -157,15 +127,10 @@ void chi_mesh::sweep_management::SweepScheduler::ScheduleAlgoDOG()
       // and it is ready then it will be given permission
       if (status == Status::READY_TO_EXECUTE /*and as == scheduled_angleset*/)
       {
-        std::stringstream message_i;
-        message_i
-          << "Angleset " << angset_number
-          << " executed on location " << chi_mpi.location_id;
-
-        auto ev_info_i = std::make_shared<ChiLog::EventInfo>(message_i.str());
-
-        chi_log.LogEvent(sweep_event_tag,
-                         ChiLog::EventType::SINGLE_OCCURRENCE,ev_info_i);
+        if (log_angleset_events)
+          LogAngleSetEvent(angset_number, "executed");
+        chi_log.tracer.Trace(trace_angleset_id,ChiTracer::Phase::BEGIN,
+                             angset_number);
 
         status = angleset->
           AngleSetAdvance(sweep_chunk,
@@ -173,24 +138,34 @@ void chi_mesh::sweep_management::SweepScheduler::ScheduleAlgoDOG()
                           sweep_timing_events_tag,
                           ExePerm::EXECUTE);
 
-        std::stringstream message_f;
-        message_f
-          << "Angleset " << angset_number
-          << " finished on location " << chi_mpi.location_id;
-
-        auto ev_info_f = std::make_shared<ChiLog::EventInfo>(message_f.str());
-
-        chi_log.LogEvent(sweep_event_tag,
-                         ChiLog::EventType::SINGLE_OCCURRENCE,ev_info_f);
+        chi_log.tracer.Trace(trace_angleset_id,ChiTracer::Phase::END,
+                             angset_number);
+        if (log_angleset_events)
+          LogAngleSetEvent(angset_number, "finished");
 
         scheduled_angleset++; //Schedule the next angleset
+        progressed = true;
       }
 
+      if (status == Status::RECEIVING)
+        receiving = true;
+
       if (status != Status::FINISHED)
         finished = false;
     }//for each angleset rule
+
+    //=============================== Block until something can progress
+    if (event_driven and not finished and not progressed)
+    {
+      chi_log.tracer.Trace(trace_wait_id,ChiTracer::Phase::BEGIN);
+      WaitForEvents(receiving);
+      chi_log.tracer.Trace(trace_wait_id,ChiTracer::Phase::END);
+    }
   }//while not finished
 
+  ProgressAggregatedMessages();
+  if (msg_aggregator != nullptr) msg_aggregator->CompleteSends();
+
   //================================================== Reset all
   for (auto angset_group : angle_agg->angle_set_groups)
     angset_group->ResetSweep();
@@ -204,13 +179,9 @@ void chi_mesh::sweep_management::SweepScheduler::ScheduleAlgoDOG()
     }
   }
 
-  //================================================== Receive delayed data
-  MPI_Barrier(MPI_COMM_WORLD);
-  for (auto sorted_angleset : rule_values)
-  {
-    TAngleSet *angleset = sorted_angleset.angle_set;
-    angleset->ReceiveDelayedData(sorted_angleset.set_index);
-  }
+  //The delayed data is not received here. It completes lazily in the
+  //next sweep or when accessed through the angle aggregation.
 
+  chi_log.tracer.Trace(trace_sweep_id,ChiTracer::Phase::END);
   chi_log.LogEvent(sweep_event_tag, ChiLog::EventType::EVENT_END);
 }
\ No newline at end of file
@@ -0,0 +1,83 @@
+#include "sweepscheduler.h"
+
+#include <chi_log.h>
+
+extern ChiLog chi_log;
+
+//###################################################################
+/**Sets whether the Depth-Of-Graph schedulers block when no angle set
+ * can make progress. Instead of re-polling every angle set the
+ * scheduler then waits on the outstanding MPI requests of all angle
+ * sets and only continues once at least one has completed. This frees
+ * the core while the sweep is communication bound.*/
+void chi_mesh::sweep_management::SweepScheduler::
+  SetEventDriven(bool in_event_driven)
+{
+  event_driven = in_event_driven;
+}
+
+//###################################################################
+/**Blocks until an event occurs that can allow an angle set to
+ * progress. The pending requests of all angle sets are collected and
+ * waited on with MPI_Waitsome, the completed ones are handed back to
+ * their angle sets. With message aggregation the upstream data arrives
+ * as aggregates, in which case the wait is on the next aggregate while
+ * any angle set is still receiving, unless delayed data of the previous
+ * sweep is outstanding.
+ *
+ * The flag receiving indicates that at least one angle set is still
+ * waiting for upstream data.*/
+void chi_mesh::sweep_management::SweepScheduler::WaitForEvents(bool receiving)
+{
+  if (receiving and msg_aggregator != nullptr)
+  {
+    //Delayed data of the previous sweep is not aggregated, while it is
+    //outstanding the scheduler keeps polling
+    for (auto& rule_value : rule_values)
+      if (rule_value.angle_set->DelayedReceivesPending()) return;
+
+    msg_aggregator->WaitForMessage();
+    return;
+  }
+
+  //================================================== Collect requests
+  event_requests.clear();
+  event_request_ids.clear();
+  event_request_rules.clear();
+  for (size_t r=0; r<rule_values.size(); r++)
+  {
+    rule_values[r].angle_set->GetPendingRequests(event_requests,
+                                                 event_request_ids);
+    event_request_rules.resize(event_request_ids.size(),r);
+  }
+
+  //Nothing to wait on, e.g. an angle set waiting on a boundary
+  if (event_requests.empty()) return;
+
+  //================================================== Wait
+  event_completed_indices.resize(event_requests.size());
+  int num_completed = 0;
+  int error_code = MPI_Waitsome(event_requests.size(),
+                                event_requests.data(),
+                                &num_completed,
+                                event_completed_indices.data(),
+                                MPI_STATUSES_IGNORE);
+
+  if (error_code != MPI_SUCCESS)
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "SweepScheduler: MPI_Waitsome failed while waiting for sweep "
+         "events.";
+    exit(EXIT_FAILURE);
+  }
+
+  //================================================== Hand back completions
+  if (num_completed == MPI_UNDEFINED) return;
+
+  for (int k=0; k<num_completed; k++)
+  {
+    int i = event_completed_indices[k];
+    rule_values[event_request_rules[i]].angle_set->
+      CompleteRequest(event_request_ids[i]);
+  }
+}
@@ -18,6 +18,7 @@ void chi_mesh::sweep_management::SweepScheduler::ScheduleAlgoFIFO()
 
   chi_log.LogEvent(sweep_event_tag,
                    ChiLog::EventType::SINGLE_OCCURRENCE,ev_info_i);
+  chi_log.tracer.Trace(trace_sweep_id,ChiTracer::Phase::BEGIN);
 
   //================================================== Loop over AngleSetGroups
   // For 3D geometry this will be 8, one for each octant.
@@ -27,6 +28,7 @@ void chi_mesh::sweep_management::SweepScheduler::ScheduleAlgoFIFO()
   while (completion_status == AngleSetStatus::NOT_FINISHED)
   {
     completion_status = AngleSetStatus::FINISHED;
+    ProgressAggregatedMessages();
     for (int q=0; q<angle_agg->angle_set_groups.size(); q++)
     {
       completion_status = angle_agg->angle_set_groups[q]->
@@ -34,6 +36,9 @@ void chi_mesh::sweep_management::SweepScheduler::ScheduleAlgoFIFO()
     }
   }
 
+  ProgressAggregatedMessages();
+  if (msg_aggregator != nullptr) msg_aggregator->CompleteSends();
+
   //================================================== Reset all
   for (auto angsetgroup : angle_agg->angle_set_groups)
     angsetgroup->ResetSweep();
@@ -47,14 +52,10 @@ void chi_mesh::sweep_management::SweepScheduler::ScheduleAlgoFIFO()
     }
   }
 
-  //================================================== Receive delayed data
-  MPI_Barrier(MPI_COMM_WORLD);
-  for (auto sorted_angleset : rule_values)
-  {
-    TAngleSet *angleset = sorted_angleset.angle_set;
-    angleset->ReceiveDelayedData(sorted_angleset.set_index);
-  }
+  //The delayed data is not received here. It completes lazily in the
+  //next sweep or when accessed through the angle aggregation.
 
+  chi_log.tracer.Trace(trace_sweep_id,ChiTracer::Phase::END);
   chi_log.LogEvent(sweep_event_tag, ChiLog::EventType::EVENT_END);
 
 }
\ No newline at end of file
@@ -0,0 +1,195 @@
+#include "sweepscheduler.h"
+
+#include "ChiMesh/SweepUtilities/SPDS/SPDS.h"
+
+#include <chi_mpi.h>
+#include <chi_log.h>
+
+extern ChiMPI chi_mpi;
+extern ChiLog chi_log;
+
+#include <map>
+#include <algorithm>
+#include <sstream>
+#include <iomanip>
+
+//###################################################################
+/**Computes the b-level of every angle set's sweep ordering. Angle sets
+ * sharing an SPDS share the computation. Must be called by all
+ * locations.
+ *
+ * ComputeBottomLevel is collective, hence the SPDS are visited in angle
+ * set order, which is the same on all locations, and not in the
+ * location dependent priority order of the rule values.*/
+void chi_mesh::sweep_management::SweepScheduler::ComputeBottomLevels()
+{
+  std::vector<size_t> rule_order(rule_values.size());
+  for (size_t r=0; r<rule_values.size(); r++)
+    rule_order[r] = r;
+
+  std::sort(rule_order.begin(),rule_order.end(),
+            [this](size_t a, size_t b)
+            {return rule_values[a].set_index < rule_values[b].set_index;});
+
+  std::map<SPDS*,long long> spds_bottom_level;
+  for (size_t r : rule_order)
+  {
+    auto& rule = rule_values[r];
+    auto spds = rule.angle_set->GetSPDS();
+    if (spds_bottom_level.count(spds) == 0)
+      spds_bottom_level[spds] = ComputeBottomLevel(spds);
+
+    rule.bottom_level = spds_bottom_level[spds];
+  }
+
+  bottom_levels_computed = true;
+}
+
+//###################################################################
+/**Sorts the rule values into the priority order of the scheduling
+ * algorithm. All priority based algorithms break ties with the
+ * Depth-Of-Graph order, which itself breaks ties with the signs of the
+ * direction cosines and finally the angle set number.*/
+void chi_mesh::sweep_management::SweepScheduler::SortRuleValues()
+{
+  const SchedulingAlgorithm algorithm = scheduler_type;
+
+  auto compare_dog = [](const RULE_VALUES& a, const RULE_VALUES& b)
+  {
+    if (a.depth_of_graph != b.depth_of_graph)
+      return a.depth_of_graph > b.depth_of_graph;
+    if (a.sign_of_omegax != b.sign_of_omegax)
+      return a.sign_of_omegax > b.sign_of_omegax;
+    if (a.sign_of_omegay != b.sign_of_omegay)
+      return a.sign_of_omegay > b.sign_of_omegay;
+    if (a.sign_of_omegaz != b.sign_of_omegaz)
+      return a.sign_of_omegaz > b.sign_of_omegaz;
+    return a.set_index < b.set_index;
+  };
+
+  auto compare = [algorithm,&compare_dog](const RULE_VALUES& a,
+                                          const RULE_VALUES& b)
+  {
+    switch (algorithm)
+    {
+      case SchedulingAlgorithm::BOTTOM_LEVEL:
+        if (a.bottom_level != b.bottom_level)
+          return a.bottom_level > b.bottom_level;
+        break;
+      case SchedulingAlgorithm::MOST_SUCCESSORS:
+        if (a.num_successors != b.num_successors)
+          return a.num_successors > b.num_successors;
+        break;
+      case SchedulingAlgorithm::EAGER_THEN_DEPTH:
+        if ((a.num_successors > 0) != (b.num_successors > 0))
+          return a.num_successors > 0;
+        break;
+      default:
+        break;
+    }
+    return compare_dog(a,b);
+  };
+
+  std::sort(rule_values.begin(),rule_values.end(),compare);
+}
+
+//###################################################################
+/**Changes the scheduling algorithm. Selecting BOTTOM_LEVEL for the
+ * first time computes the b-levels, in which case this must be called
+ * by all locations.*/
+void chi_mesh::sweep_management::SweepScheduler::
+  SetSchedulingAlgorithm(SchedulingAlgorithm in_scheduler_type)
+{
+  scheduler_type = in_scheduler_type;
+
+  if (scheduler_type == SchedulingAlgorithm::BOTTOM_LEVEL and
+      not bottom_levels_computed)
+    ComputeBottomLevels();
+
+  SortRuleValues();
+}
+
+//###################################################################
+/**Sweeps num_sweeps times with every scheduling algorithm and reports,
+ * per algorithm, the sweep time and the idle time of every location.
+ * The idle time of a location is the sweep time minus the time during
+ * which at least one of its sweep chunks was executing. The scheduling
+ * algorithm is restored afterwards. The sweeps accumulate into the
+ * destination of the sweep chunk. Must be called by all locations, the
+ * report is returned and logged on location 0.*/
+std::string chi_mesh::sweep_management::SweepScheduler::
+  CompareSchedulingAlgorithms(SweepChunk* in_sweep_chunk, int num_sweeps)
+{
+  const SchedulingAlgorithm original_type = scheduler_type;
+
+  const std::vector<std::pair<SchedulingAlgorithm,std::string>> algorithms =
+    {{SchedulingAlgorithm::FIRST_IN_FIRST_OUT, "FIRST_IN_FIRST_OUT"},
+     {SchedulingAlgorithm::DEPTH_OF_GRAPH    , "DEPTH_OF_GRAPH"},
+     {SchedulingAlgorithm::BOTTOM_LEVEL      , "BOTTOM_LEVEL"},
+     {SchedulingAlgorithm::MOST_SUCCESSORS   , "MOST_SUCCESSORS"},
+     {SchedulingAlgorithm::EAGER_THEN_DEPTH  , "EAGER_THEN_DEPTH"}};
+
+  const int P = chi_mpi.process_count;
+
+  std::stringstream report;
+  report << std::fixed << std::setprecision(6);
+  report << "Sweep scheduler comparison, " << num_sweeps
+         << " sweeps per algorithm, times in seconds per sweep.\n";
+
+  for (const auto& algorithm : algorithms)
+  {
+    SetSchedulingAlgorithm(algorithm.first);
+
+    //================================= Timed sweeps
+    MPI_Barrier(MPI_COMM_WORLD);
+    double busy_start = chi_log.ProcessEvent(
+      sweep_timing_events_tag[0],ChiLog::EventOperation::TOTAL_DURATION);
+    double time_start = MPI_Wtime();
+
+    for (int s=0; s<num_sweeps; s++)
+      Sweep(in_sweep_chunk);
+
+    double sweep_time = (MPI_Wtime() - time_start)/num_sweeps;
+    double busy_time  = 1.0e-6*(chi_log.ProcessEvent(
+      sweep_timing_events_tag[0],ChiLog::EventOperation::TOTAL_DURATION) -
+      busy_start)/num_sweeps;
+    double idle_time  = std::max(0.0,sweep_time - busy_time);
+
+    //================================= Gather
+    double max_sweep_time = 0.0;
+    MPI_Allreduce(&sweep_time,&max_sweep_time,1,MPI_DOUBLE,MPI_MAX,
+                  MPI_COMM_WORLD);
+
+    std::vector<double> idle_times(P,0.0);
+    MPI_Gather(&idle_time,1,MPI_DOUBLE,
+               idle_times.data(),1,MPI_DOUBLE,0,MPI_COMM_WORLD);
+
+    if (chi_mpi.location_id != 0) continue;
+
+    //================================= Report
+    double min_idle = idle_times[0], max_idle = idle_times[0], avg_idle = 0.0;
+    for (double idle : idle_times)
+    {
+      min_idle  = std::min(min_idle,idle);
+      max_idle  = std::max(max_idle,idle);
+      avg_idle += idle/P;
+    }
+
+    report << "  " << std::left << std::setw(20) << algorithm.second
+           << std::right
+           << " sweep " << max_sweep_time
+           << " idle min " << min_idle
+           << " avg " << avg_idle
+           << " max " << max_idle << "\n";
+    report << "    idle per location:";
+    for (int loc=0; loc<P; loc++)
+      report << " " << idle_times[loc];
+    report << "\n";
+  }
+
+  SetSchedulingAlgorithm(original_type);
+
+  chi_log.Log(LOG_0) << report.str();
+
+  return (chi_mpi.location_id == 0)? report.str() : std::string();
+}
@@ -4,7 +4,9 @@
 extern ChiLog chi_log;
 
 //###################################################################
-/**This is the entry point for sweeping.*/
+/**This is the entry point for sweeping. All algorithms other than
+ * FIRST_IN_FIRST_OUT use the Depth-Of-Graph loop with their own
+ * priority order.*/
 void chi_mesh::sweep_management::SweepScheduler::
      Sweep(SweepChunk* in_sweep_chunk)
 {
@@ -12,8 +14,16 @@ void chi_mesh::sweep_management::SweepScheduler::
 
   if (scheduler_type == SchedulingAlgorithm::FIRST_IN_FIRST_OUT)
     ScheduleAlgoFIFO();
-  else if (scheduler_type == SchedulingAlgorithm::DEPTH_OF_GRAPH)
-    ScheduleAlgoDOG();
+  else
+  {
+    if (num_threads > 1 and InitializeThreadedSweep())
+    {
+      ScheduleAlgoDOGThreaded();
+      FinalizeThreadedSweep();
+    }
+    else
+      ScheduleAlgoDOG();
+  }
 }
 
 //###################################################################
@@ -0,0 +1,210 @@
+#include "sweepscheduler.h"
+
+#include <chi_mpi.h>
+#include <chi_log.h>
+
+extern ChiMPI chi_mpi;
+extern ChiLog chi_log;
+
+#include <thread>
+#include <chrono>
+
+//###################################################################
+/**Creates a worker copy of the sweep chunk for every thread, each with
+ * its own zeroed flux-moment accumulator. Returns false if the sweep
+ * chunk cannot be copied, in which case the sweep has to be performed
+ * on a single thread.*/
+bool chi_mesh::sweep_management::SweepScheduler::InitializeThreadedSweep()
+{
+  if (thread_pool == nullptr or sweep_chunk == nullptr) return false;
+
+  size_t phi_size = sweep_chunk->x->size();
+
+  thread_chunks.assign(num_threads, nullptr);
+  thread_phi.resize(num_threads);
+  for (int t=0; t<num_threads; t++)
+  {
+    thread_chunks[t] = sweep_chunk->CreateWorkerCopy();
+    if (thread_chunks[t] == nullptr)
+    {
+      chi_log.Log(LOG_0WARNING)
+        << "SweepScheduler: The sweep chunk does not support threaded "
+           "execution. Sweeping with a single thread.";
+      for (auto chunk : thread_chunks) delete chunk;
+      thread_chunks.clear();
+      num_threads = 1;
+      delete thread_pool;
+      thread_pool = nullptr;
+      return false;
+    }
+
+    thread_phi[t].assign(phi_size, 0.0);
+    thread_chunks[t]->SetDestinationPhi(&thread_phi[t]);
+  }
+
+  completed_rules.clear();
+
+  return true;
+}
+
+//###################################################################
+/**Reduces the per-thread flux-moment accumulators into the sweep
+ * chunk's destination and deletes the worker copies.*/
+void chi_mesh::sweep_management::SweepScheduler::FinalizeThreadedSweep()
+{
+  std::vector<double>& phi = *sweep_chunk->x;
+  for (auto& phi_t : thread_phi)
+    for (size_t i=0; i<phi.size(); i++)
+      phi[i] += phi_t[i];
+
+  for (auto chunk : thread_chunks) delete chunk;
+  thread_chunks.clear();
+}
+
+//###################################################################
+/**Executes the Depth-Of-Graph algorithm with the sweep chunks of ready
+ * angle sets executing concurrently on the thread pool. The calling
+ * thread receives upstream data, hands ready angle sets to the pool in
+ * depth-of-graph order and sends the downstream data of completed
+ * angle sets. The chunk timing event spans the periods during which at
+ * least one chunk is executing.*/
+void chi_mesh::sweep_management::SweepScheduler::ScheduleAlgoDOGThreaded()
+{
+  typedef ExecutionPermission ExePerm;
+  typedef AngleSetStatus Status;
+
+  chi_log.LogEvent(sweep_event_tag, ChiLog::EventType::EVENT_BEGIN);
+
+  auto ev_info =
+    std::make_shared<ChiLog::EventInfo>(std::string("Sweep initiated"));
+
+  chi_log.LogEvent(sweep_event_tag,
+                   ChiLog::EventType::SINGLE_OCCURRENCE,ev_info);
+  chi_log.tracer.Trace(trace_sweep_id,ChiTracer::Phase::BEGIN);
+
+  std::vector<bool>   in_flight(rule_values.size(),false);
+  std::vector<size_t> newly_completed;
+  int num_in_flight = 0;
+
+  //==================================================== Loop till done
+  bool finished = false;
+  while (!finished)
+  {
+    finished = true;
+    bool progressed = false;
+    bool receiving  = false;
+
+    ProgressAggregatedMessages();
+
+    //=============================== Complete executed anglesets
+    {
+      std::lock_guard<std::mutex> lock(completed_mutex);
+      newly_completed.swap(completed_rules);
+    }
+    for (size_t as : newly_completed)
+    {
+      rule_values[as].angle_set->
+        CompleteExecution(rule_values[as].set_index);
+      in_flight[as] = false;
+      if (--num_in_flight == 0)
+        chi_log.LogEvent(sweep_timing_events_tag[0],
+                         ChiLog::EventType::EVENT_END);
+      progressed = true;
+    }
+    newly_completed.clear();
+
+    //=============================== Advance anglesets
+    for (size_t as=0; as<rule_values.size(); as++)
+    {
+      if (in_flight[as]) {finished = false; continue;}
+
+      TAngleSet* angleset = rule_values[as].angle_set;
+      int angset_number = rule_values[as].set_index;
+
+      Status status = angleset->
+        AngleSetAdvance(sweep_chunk,
+                        angset_number,
+                        sweep_timing_events_tag,
+                        ExePerm::NO_EXEC_IF_READY);
+
+      //=============================== Hand ready anglesets to the pool
+      if (status == Status::READY_TO_EXECUTE)
+      {
+        angleset->PrepareForExecution();
+
+        in_flight[as] = true;
+        if (num_in_flight++ == 0)
+          chi_log.LogEvent(sweep_timing_events_tag[0],
+                           ChiLog::EventType::EVENT_BEGIN);
+
+        thread_pool->Submit([this,angleset,as,angset_number](int worker_id)
+        {
+          chi_log.tracer.Trace(trace_angleset_id,ChiTracer::Phase::BEGIN,
+                               angset_number);
+          thread_chunks[worker_id]->Sweep(angleset);
+          chi_log.tracer.Trace(trace_angleset_id,ChiTracer::Phase::END,
+                               angset_number);
+
+          {
+            std::lock_guard<std::mutex> lock(completed_mutex);
+            completed_rules.push_back(as);
+          }
+          completed_cv.notify_one();
+        });
+
+        progressed = true;
+        status = Status::NOT_FINISHED;
+      }
+
+      if (status == Status::RECEIVING)
+        receiving = true;
+
+      if (status != Status::FINISHED)
+        finished = false;
+    }//for each angleset rule
+
+    //=============================== Idle
+    // Event-driven: block on the workers while chunks are executing,
+    // waking periodically to progress communication, otherwise block
+    // on MPI.
+    if (not progressed and not finished and event_driven)
+    {
+      if (num_in_flight > 0)
+      {
+        std::unique_lock<std::mutex> lock(completed_mutex);
+        completed_cv.wait_for(lock,std::chrono::microseconds(100),
+                              [this]{return not completed_rules.empty();});
+      }
+      else
+      {
+        chi_log.tracer.Trace(trace_wait_id,ChiTracer::Phase::BEGIN);
+        WaitForEvents(receiving);
+        chi_log.tracer.Trace(trace_wait_id,ChiTracer::Phase::END);
+      }
+    }
+    else if (not progressed)
+      std::this_thread::yield();
+  }//while not finished
+
+  ProgressAggregatedMessages();
+  if (msg_aggregator != nullptr) msg_aggregator->CompleteSends();
+
+  //================================================== Reset all
+  for (auto angset_group : angle_agg->angle_set_groups)
+    angset_group->ResetSweep();
+
+  for (auto bndry : angle_agg->sim_boundaries)
+  {
+    if (bndry->Type() == chi_mesh::sweep_management::BoundaryType::REFLECTING)
+    {
+      auto rbndry = (chi_mesh::sweep_management::BoundaryReflecting*)bndry;
+      rbndry->ResetAnglesReadyStatus();
+    }
+  }
+
+  //The delayed data is not received here. It completes lazily in the
+  //next sweep or when accessed through the angle aggregation.
+
+  chi_log.tracer.Trace(trace_sweep_id,ChiTracer::Phase::END);
+  chi_log.LogEvent(sweep_event_tag, ChiLog::EventType::EVENT_END);
+}
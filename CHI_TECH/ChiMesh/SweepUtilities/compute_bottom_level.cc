@@ -0,0 +1,77 @@
+#include "../chi_mesh.h"
+#include "sweep_namespace.h"
+
+#include "ChiMesh/SweepUtilities/SPDS/SPDS.h"
+
+#include <chi_mpi.h>
+#include <chi_log.h>
+
+extern ChiMPI chi_mpi;
+extern ChiLog chi_log;
+
+#include <algorithm>
+
+//###################################################################
+/**Computes the bottom level (b-level) of this location in the global
+ * task graph of a sweep ordering. The b-level is the heaviest path,
+ * weighted by the number of local cells, from this location down to
+ * any sink of the graph, including this location itself. Delayed
+ * successors are ignored.
+ *
+ * The computation mirrors that of the sweep order ranks but runs
+ * against the flow: every round each location sends its current
+ * b-level to its dependencies and recomputes it from the values of its
+ * successors. Must be called by all locations.*/
+long long chi_mesh::sweep_management::
+  ComputeBottomLevel(chi_mesh::sweep_management::SPDS* sweep_order)
+{
+  const int P = chi_mpi.process_count;
+
+  const auto& dependencies = sweep_order->location_dependencies;
+  std::vector<int> successors;
+  for (int locJ : sweep_order->location_successors)
+  {
+    auto& delayed_successors = sweep_order->delayed_location_successors;
+    if (std::find(delayed_successors.begin(),delayed_successors.end(),locJ) ==
+        delayed_successors.end())
+      successors.push_back(locJ);
+  }
+
+  const long long weight = sweep_order->spls->item_id.size();
+
+  const int BLEVEL_TAG = 102;
+  std::vector<long long> successor_level(successors.size(),0);
+  std::vector<MPI_Request> requests(dependencies.size()+successors.size());
+  long long bottom_level = weight;
+  for (int round=0; ; round++)
+  {
+    if (round > P)
+    {
+      chi_log.Log(LOG_ALLERROR)
+        << "Cyclic global sweep ordering detected.";
+      exit(EXIT_FAILURE);
+    }
+
+    int r=0;
+    for (size_t s=0; s<successors.size(); s++)
+      MPI_Irecv(&successor_level[s],1,MPI_LONG_LONG,successors[s],BLEVEL_TAG,
+                MPI_COMM_WORLD,&requests[r++]);
+    for (int locJ : dependencies)
+      MPI_Isend(&bottom_level,1,MPI_LONG_LONG,locJ,BLEVEL_TAG,
+                MPI_COMM_WORLD,&requests[r++]);
+    MPI_Waitall(r,requests.data(),MPI_STATUSES_IGNORE);
+
+    long long new_level = weight;
+    for (long long succ_level : successor_level)
+      new_level = std::max(new_level,succ_level + weight);
+
+    int local_changed = (new_level != bottom_level)? 1 : 0;
+    bottom_level = new_level;
+
+    int changed = 0;
+    MPI_Allreduce(&local_changed,&changed,1,MPI_INT,MPI_MAX,MPI_COMM_WORLD);
+    if (changed == 0) break;
+  }
+
+  return bottom_level;
+}
@@ -16,14 +16,19 @@ extern ChiConsole chi_console;
 extern ChiTimer   chi_program_timer;
 
 #include <ChiGraph/chi_directed_graph.h>
+#include <algorithm>
 
 //###################################################################
 /**Develops a sweep ordering for a given angle for locally owned
- * cells.*/
+ * cells. If level_ordering is true the local cells are ordered by their
+ * depth in the local task graph and the level structure is kept in
+ * SPLS::level_start, allowing the cells of a level to be swept
+ * concurrently.*/
 chi_mesh::sweep_management::SPDS* chi_mesh::sweep_management::
 CreateSweepOrder(double polar, double azimuthal,
                  chi_mesh::MeshContinuum *grid,
-                 bool allow_cycles)
+                 bool allow_cycles,
+                 bool level_ordering)
 {
   auto sweep_order  = new chi_mesh::sweep_management::SPDS;
   sweep_order->grid = grid;
@@ -137,15 +142,53 @@ CreateSweepOrder(double polar, double azimuthal,
   //Alternatively this code can be modified to allows this
   //but I can see no reason for this other than for
   //visualization.
-  int i=0;
+  //When level ordering is requested the single sweep plane is
+  //ordered by graph depth instead, which keeps the plane a valid
+  //topological ordering.
+  std::vector<int> local_linear_order;
   for (auto ii=sorted_list.rbegin(); ii!=sorted_list.rend(); ++ii)
+    local_linear_order.push_back(index_map[*ii]);
+
+  sweep_order->spls = new chi_mesh::sweep_management::SPLS;
+
+  if (level_ordering)
   {
-    if (i==0) sweep_order->spls = new chi_mesh::sweep_management::SPLS;
+    //================================ Compute cell depths
+    std::vector<int> cell_depth(num_loc_cells,0);
+    int max_depth = 0;
+    for (int c : local_linear_order)
+    {
+      for (auto successor : cell_successors[c])
+      {
+        if (!boost::edge(c,successor,G).second) continue; //cyclic, removed
+
+        cell_depth[successor] = std::max(cell_depth[successor],
+                                         cell_depth[c] + 1);
+        max_depth = std::max(max_depth, cell_depth[successor]);
+      }
+    }
 
-    int cell_local_id = index_map[*ii];
+    //================================ Order by depth
+    std::stable_sort(local_linear_order.begin(),
+                     local_linear_order.end(),
+                     [&cell_depth](int a, int b)
+                     {return cell_depth[a] < cell_depth[b];});
+
+    auto& level_start = sweep_order->spls->level_start;
+    level_start.assign(max_depth+2,0);
+    for (int c : local_linear_order)
+      level_start[cell_depth[c]+1]++;
+    for (int l=0; l<=max_depth; l++)
+      level_start[l+1] += level_start[l];
+
+    chi_log.Log(LOG_0VERBOSE_1)
+      << "Number of local sweep levels: " << max_depth+1;
+  }
+
+  for (int cell_local_id : local_linear_order)
+  {
     int cell_global_index = grid->local_cell_glob_indices[cell_local_id];
     sweep_order->spls->item_id.push_back(cell_global_index);
-    ++i;
   }
 
   G.clearing_graph();
@@ -155,200 +198,104 @@ CreateSweepOrder(double polar, double azimuthal,
   << " Communicating sweep dependencies.";
 
   //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%% Create Task Dependency Graphs
-  //All locations will send their dependencies
-  //to the other locations
-  int P = chi_mpi.process_count;
-  std::vector<int> dependency_count_per_location(P,0);
-  std::vector<std::vector<int>> global_dependencies(P, std::vector<int>());
-
-  dependency_count_per_location[chi_mpi.location_id] =
-    sweep_order->location_dependencies.size();
-
-  //============================================= Broadcast location dep counts
-  for (int locI=0; locI<P; locI++)
-  {
-    MPI_Bcast(&dependency_count_per_location[locI], //Buffer
-              1, MPI_INT,                           //Count and type
-              locI,                                 //Sending location
-              MPI_COMM_WORLD);                      //Communicator
-  }
-
-  //============================================= Broadcast dependencies
-  for (int locI=0; locI<P; locI++)
-  {
-    if (locI == chi_mpi.location_id)
-    {
-      std::copy(sweep_order->location_dependencies.begin(),
-                sweep_order->location_dependencies.end(),
-                std::back_inserter(global_dependencies[locI]));
-    } else
-    {
-      global_dependencies[locI].
-        resize(dependency_count_per_location[locI],-1);
-    }
-
-    MPI_Bcast(global_dependencies[locI].data(), //Buffer
-              dependency_count_per_location[locI],     //Count
-              MPI_INT,                                 //Type
-              locI,                                    //Sending location
-              MPI_COMM_WORLD);                         //Communicator
-  }
+  //The dependencies of every location are only gathered globally when
+  //cycles have to be removed, which requires searching the global graph.
+  //The sweep order ranks are otherwise computed by exchanging ranks
+  //with the neighboring locations only.
+  const int P = chi_mpi.process_count;
 
   //====================================== Filter dependencies for cycles
-  chi_log.Log(LOG_0VERBOSE_1)
-    << chi_program_timer.GetTimeString()
-    << " Removing intra-cellset cycles.";
-
-  const bool ALLOW_RECURSIVE_SEARCH = true;
-
   if (allow_cycles)
   {
-    RemoveGlobalCyclicDependencies(sweep_order,global_dependencies);
-    RemoveGlobalCyclicDependencies(sweep_order,global_dependencies,
-                                   ALLOW_RECURSIVE_SEARCH);
+    chi_log.Log(LOG_0VERBOSE_1)
+      << chi_program_timer.GetTimeString()
+      << " Removing intra-cellset cycles.";
+
+    std::vector<std::vector<int>> global_dependencies =
+      GatherGlobalDependencies(sweep_order->location_dependencies);
+
+    auto delayed_dependencies =
+      RemoveGlobalCyclicDependencies(sweep_order,global_dependencies);
+
+    chi_log.Log(LOG_0VERBOSE_1)
+      << "Number of delayed location dependencies: "
+      << delayed_dependencies.size();
+    for (auto& delayed : delayed_dependencies)
+      chi_log.Log(LOG_0VERBOSE_2)
+        << "  Location " << delayed.first
+        << " delays its dependency on location " << delayed.second;
   }//if cycles allowed
-  MPI_Barrier(MPI_COMM_WORLD);
 
-  //====================================== Build task dependency graph
+  //====================================== Determine sweep order ranks
+  // The rank of a location is the length of the longest dependency
+  // path leading to it. Every round each location sends its current
+  // rank to its successors and recomputes it from the ranks of its
+  // dependencies. For an acyclic graph this converges after
+  // (max rank + 1) rounds.
   chi_log.Log(LOG_0VERBOSE_1)
     << chi_program_timer.GetTimeString()
-    << " Building Task Dependency Graphs.";
-  CHI_D_GRAPH TDG;
-  std::vector<int> glob_linear_sweep_order;
-  std::vector<int> glob_sweep_order_rank;
-  std::vector<int> glob_order_mapping;
-
-  //================================= Add vertices to the graph
-  for (int loc=0; loc<chi_mpi.process_count; loc++)
+    << " Determining sweep order ranks.";
+
+  const auto& dependencies = sweep_order->location_dependencies;
+  std::vector<int> successors;
+  for (int locJ : sweep_order->location_successors)
   {
-    boost::add_vertex(TDG);
-    glob_sweep_order_rank.push_back(-1);
-    glob_order_mapping.push_back(loc);
+    auto& delayed_successors = sweep_order->delayed_location_successors;
+    if (std::find(delayed_successors.begin(),delayed_successors.end(),locJ) ==
+        delayed_successors.end())
+      successors.push_back(locJ);
   }
 
-  chi_log.Log(LOG_ALLVERBOSE_1)
-    << chi_program_timer.GetTimeString()
-    << "   - Adding dependencies.";
-  //================================= Add dependencies
-  for (int loc=0; loc<chi_mpi.process_count; loc++)
+  const int RANK_TAG = 101;
+  std::vector<int> dependency_rank(dependencies.size(),0);
+  std::vector<MPI_Request> requests(dependencies.size()+successors.size());
+  int location_rank = 0;
+  for (int round=0; ; round++)
   {
-    chi_log.Log(LOG_0VERBOSE_1) << "Location " << loc;
-    for (int dep=0; dep<global_dependencies[loc].size(); dep++)
+    if (round > P)
     {
-      if (global_dependencies[loc][dep]>=0)
-      {
-        boost::add_edge(global_dependencies[loc][dep], loc, TDG);
-
-        chi_log.Log(LOG_0VERBOSE_1) << " depends loc " << global_dependencies[loc][dep];
-      }
-
+      chi_log.Log(LOG_ALLERROR)
+        << "Cyclic global sweep ordering detected.";
+      exit(EXIT_FAILURE);
     }
-  }
-
-  //================================= Generate topological sort
-  chi_log.Log(LOG_ALLVERBOSE_1)
-    << chi_program_timer.GetTimeString()
-    << "   - Generating topological sort.";
-  boost::property_map<CHI_D_GRAPH, boost::vertex_index_t>::type
-    glob_index_map = get(boost::vertex_index, TDG);
-
-  std::vector<gVertex> glob_sorted_list;
-  try {
-    boost::topological_sort(TDG, std::back_inserter(glob_sorted_list));
-  }
-  catch (const boost::bad_graph& exc)
-  {
-    chi_log.Log(LOG_ALLERROR)
-      << "Cyclic global sweep ordering detected.";
-    exit(EXIT_FAILURE);
-  }
-
-  //================================= Generate linear ordering
-  // This step just puts the topological
-  // sorting into a std::vector.
-  chi_log.Log(LOG_0VERBOSE_1)
-    << chi_program_timer.GetTimeString()
-    << " Generating global ordering.";
-  for (std::vector<gVertex>::reverse_iterator ii=glob_sorted_list.rbegin();
-       ii!=glob_sorted_list.rend();
-       ii++)
-  {
-    int location_index = glob_index_map[*ii];
-    glob_linear_sweep_order.push_back(location_index);
-  }
-  if (glob_linear_sweep_order.empty())
-  {
-    chi_log.Log(LOG_0ERROR) << "Empty linear sweep ordering.";
-    exit(EXIT_FAILURE);
-  }
 
-
-  //================================= Compute reorder mapping
-  // This mapping allows us to punch in
-  // the location id and find what its
-  // id is in the TDG
-  size_t num_ord = glob_linear_sweep_order.size();
-  for (int k=0; k<num_ord; k++)
-  {
-    int loc = glob_linear_sweep_order[k];
-    glob_order_mapping[loc] = k;
+    int r=0;
+    for (size_t d=0; d<dependencies.size(); d++)
+      MPI_Irecv(&dependency_rank[d],1,MPI_INT,dependencies[d],RANK_TAG,
+                MPI_COMM_WORLD,&requests[r++]);
+    for (int locJ : successors)
+      MPI_Isend(&location_rank,1,MPI_INT,locJ,RANK_TAG,
+                MPI_COMM_WORLD,&requests[r++]);
+    MPI_Waitall(r,requests.data(),MPI_STATUSES_IGNORE);
+
+    int new_rank = 0;
+    for (int dep_rank : dependency_rank)
+      new_rank = std::max(new_rank,dep_rank + 1);
+
+    int local_changed = (new_rank != location_rank)? 1 : 0;
+    location_rank = new_rank;
+
+    int changed = 0;
+    MPI_Allreduce(&local_changed,&changed,1,MPI_INT,MPI_MAX,MPI_COMM_WORLD);
+    if (changed == 0) break;
   }
 
-  //================================= Determine sweep order ranks
-  chi_log.Log(LOG_0VERBOSE_1)
-    << chi_program_timer.GetTimeString()
-    << " Determining sweep order ranks.";
   int abs_max_rank = 0;
-  for (int k=0; k<num_ord; k++)
-  {
-    chi_log.Log(LOG_0VERBOSE_1) << k;
-    int loc = glob_linear_sweep_order[k];
-    if (global_dependencies[loc].empty())
-    {
-      glob_sweep_order_rank[k] = 0;
-    }
-    else
-    {
-      int max_rank = -1;
-      for (int dep=0; dep<global_dependencies[loc].size(); dep++)
-      {
-        int dep_loc = global_dependencies[loc][dep];
-        if (dep_loc <0)
-          continue;
-        int dep_mapped_index = glob_order_mapping[dep_loc];
-
-        if (glob_sweep_order_rank[dep_mapped_index] > max_rank)
-        {
-          max_rank = glob_sweep_order_rank[dep_mapped_index];
-        }
-      }
-      glob_sweep_order_rank[k] = max_rank + 1;
-      if ((max_rank + 1) > abs_max_rank)
-      {
-        abs_max_rank = max_rank + 1;
-      }
-    }
-  }
+  MPI_Allreduce(&location_rank,&abs_max_rank,1,MPI_INT,MPI_MAX,MPI_COMM_WORLD);
 
   //================================= Generate TDG structure
   chi_log.Log(LOG_0VERBOSE_1)
     << chi_program_timer.GetTimeString()
     << " Generating TDG structure.";
   for (int r=0; r<=abs_max_rank; r++)
-  {
-    auto new_stdg = new chi_mesh::sweep_management::STDG;
-    sweep_order->global_sweep_planes.push_back(new_stdg);
-
-    for (int k=0; k<num_ord; k++)
-    {
-      if (glob_sweep_order_rank[k] == r)
-      {
-        new_stdg->item_id.push_back(glob_linear_sweep_order[k]);
-      }
-    }
-  }
-
-  TDG.clear();
+    sweep_order->global_sweep_planes.push_back(
+      new chi_mesh::sweep_management::STDG);
+
+  sweep_order->global_sweep_planes[location_rank]->
+    item_id.push_back(chi_mpi.location_id);
+  for (size_t d=0; d<dependencies.size(); d++)
+    sweep_order->global_sweep_planes[dependency_rank[d]]->
+      item_id.push_back(dependencies[d]);
 
   MPI_Barrier(MPI_COMM_WORLD);
 
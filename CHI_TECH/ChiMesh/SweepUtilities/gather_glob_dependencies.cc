@@ -0,0 +1,39 @@
+#include "../chi_mesh.h"
+#include "sweep_namespace.h"
+
+#include <chi_mpi.h>
+extern ChiMPI chi_mpi;
+
+//###################################################################
+/**Gathers the location dependencies of all locations onto all
+ * locations, using one count and one data collective.*/
+std::vector<std::vector<int>>
+chi_mesh::sweep_management::GatherGlobalDependencies(
+  const std::vector<int>& location_dependencies)
+{
+  const int P = chi_mpi.process_count;
+
+  //============================================= Gather counts
+  int local_count = location_dependencies.size();
+  std::vector<int> counts(P,0);
+  MPI_Allgather(&local_count,1,MPI_INT,
+                counts.data(),1,MPI_INT,MPI_COMM_WORLD);
+
+  std::vector<int> displs(P,0);
+  for (int locI=1; locI<P; locI++)
+    displs[locI] = displs[locI-1] + counts[locI-1];
+
+  //============================================= Gather dependencies
+  std::vector<int> all_dependencies(displs[P-1] + counts[P-1],-1);
+  MPI_Allgatherv(location_dependencies.data(),local_count,MPI_INT,
+                 all_dependencies.data(),counts.data(),displs.data(),MPI_INT,
+                 MPI_COMM_WORLD);
+
+  std::vector<std::vector<int>> global_dependencies(P);
+  for (int locI=0; locI<P; locI++)
+    global_dependencies[locI].assign(
+      all_dependencies.begin() + displs[locI],
+      all_dependencies.begin() + displs[locI] + counts[locI]);
+
+  return global_dependencies;
+}
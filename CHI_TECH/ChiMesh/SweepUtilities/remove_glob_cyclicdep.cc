@@ -8,103 +8,180 @@ extern ChiMPI chi_mpi;
 #include <algorithm>
 
 //###################################################################
-/** This method searches ref_glob_dep[ref_locI] for a dependency on
- * master_locI and if found will set found=true.
- * Its search is registered in search_history to prevent
- * cyclic search patterns. Optionally the routine can also be allowed to
- * search recursively.*/
-void
-chi_mesh::sweep_management::RecursivelyFindLocIDependency(
-  std::vector<std::vector<int>>& ref_glob_dep,
-  std::vector<int>& search_history,
-  int master_locI,
-  int ref_locI,
-  bool& found,
-  bool allow_recursive_search)
+/** Computes the strongly connected components of the location graph
+ * with an iterative version of Tarjan's algorithm. global_dependencies[locI]
+ * lists the locations locI depends on. Returns the component number of
+ * every location, components are numbered in the order they complete.
+ * Locations in a component with more than one member are part of a
+ * cyclic dependency.*/
+std::vector<int>
+chi_mesh::sweep_management::FindStronglyConnectedLocations(
+  const std::vector<std::vector<int>>& global_dependencies,
+  int& num_components)
 {
-  if (found) return;
-  if (ref_locI < 0) return;
+  const int P = global_dependencies.size();
 
-  auto already_searched = (
-    std::find(search_history.begin(),search_history.end(),ref_locI) !=
-    search_history.end() );
+  std::vector<int>  index(P,-1);
+  std::vector<int>  lowlink(P,0);
+  std::vector<int>  component(P,-1);
+  std::vector<bool> on_stack(P,false);
 
-  if (already_searched) return;
-  search_history.push_back(ref_locI);
+  std::vector<int>                   tarjan_stack;
+  std::vector<std::pair<int,size_t>> call_stack; //location, next dependency
 
+  int next_index = 0;
+  num_components = 0;
 
-  for (auto dependency : ref_glob_dep[ref_locI])
+  for (int root=0; root<P; root++)
   {
-    if (dependency == master_locI)
+    if (index[root] >= 0) continue;
+
+    index[root] = lowlink[root] = next_index++;
+    tarjan_stack.push_back(root);
+    on_stack[root] = true;
+    call_stack.emplace_back(root,0);
+
+    while (not call_stack.empty())
     {
-      found = true;
-      break;
-    }
-    if (allow_recursive_search)
-      RecursivelyFindLocIDependency(ref_glob_dep,
-                                    search_history,
-                                    master_locI,
-                                    dependency,
-                                    found,
-                                    allow_recursive_search);
-  }
+      int    locI = call_stack.back().first;
+      size_t d    = call_stack.back().second;
+
+      //=================================== Visit next dependency
+      if (d < global_dependencies[locI].size())
+      {
+        call_stack.back().second++;
+        int locJ = global_dependencies[locI][d];
+
+        if (index[locJ] < 0)
+        {
+          index[locJ] = lowlink[locJ] = next_index++;
+          tarjan_stack.push_back(locJ);
+          on_stack[locJ] = true;
+          call_stack.emplace_back(locJ,0);
+        }
+        else if (on_stack[locJ])
+          lowlink[locI] = std::min(lowlink[locI],index[locJ]);
+        continue;
+      }
+
+      //=================================== All dependencies visited
+      call_stack.pop_back();
+      if (not call_stack.empty())
+      {
+        int parent = call_stack.back().first;
+        lowlink[parent] = std::min(lowlink[parent],lowlink[locI]);
+      }
+
+      if (lowlink[locI] == index[locI])
+      {
+        int locJ;
+        do
+        {
+          locJ = tarjan_stack.back();
+          tarjan_stack.pop_back();
+          on_stack[locJ]  = false;
+          component[locJ] = num_components;
+        } while (locJ != locI);
+        num_components++;
+      }
+    }//while call stack
+  }//for root
+
+  return component;
 }
 
 //###################################################################
-/** This method firstly loops over each location and then each location's
- * dependencies. It can optionally also go deeper and recursively loop.
+/** Breaks all cyclic dependencies between locations. Every location
+ * holds the same global dependency graph, the strongly connected
+ * components are computed once and each cyclic component is traversed
+ * depth-first, starting from its lowest location id and following the
+ * dependencies in gathered order. A dependency that leads back to a
+ * location on the current search path closes a cycle and is delayed.
+ * Removing these back edges leaves the graph acyclic and, since the
+ * traversal only depends on the gathered graph, all locations delay
+ * the same dependencies.
  *
- * The main purpose is to find whether dependencies reference back to this
- * location, thereby identifying a cyclic dependency. When a cyclic
- * dependency is found it will be removed and the appropriate registers
- * will be set.*/
-void
+ * The dependencies of this location, and the successors depending on
+ * it, that are delayed are moved to the delayed registers of the SPDS.
+ * Returns all delayed dependencies as pairs (locI, dependency of locI).*/
+std::vector<std::pair<int,int>>
 chi_mesh::sweep_management::RemoveGlobalCyclicDependencies(
   chi_mesh::sweep_management::SPDS *sweep_order,
-  std::vector<std::vector<int>> &global_dependencies,
-  bool allow_recursive_search)
+  const std::vector<std::vector<int>> &global_dependencies)
 {
-  std::vector<int> search_history;
-  search_history.reserve(chi_mpi.location_id);
-  for (int locI=0; locI<chi_mpi.process_count; locI++)
+  const int P = global_dependencies.size();
+
+  //============================================= Find cyclic components
+  int num_components = 0;
+  std::vector<int> component =
+    FindStronglyConnectedLocations(global_dependencies, num_components);
+
+  std::vector<int> component_size(num_components,0);
+  for (int comp : component)
+    component_size[comp]++;
+
+  //============================================= Find back edges
+  const char NOT_VISITED = 0, ON_PATH = 1, DONE = 2;
+  std::vector<char> state(P,NOT_VISITED);
+
+  std::vector<std::pair<int,int>>    delayed_dependencies;
+  std::vector<std::pair<int,size_t>> call_stack; //location, next dependency
+
+  for (int root=0; root<P; root++)
   {
+    if (state[root] != NOT_VISITED) continue;
+    if (component_size[component[root]] < 2) continue;
 
-    int c=-1;
-    for (auto rlocI : global_dependencies[locI])
+    state[root] = ON_PATH;
+    call_stack.emplace_back(root,0);
+
+    while (not call_stack.empty())
     {
-      ++c;
-      if (rlocI<0) continue;
-
-      bool depends_on_locI = false;
-      search_history.clear();
-      search_history.reserve(chi_mpi.location_id);
-      RecursivelyFindLocIDependency(global_dependencies,
-                                    search_history,
-                                    locI,
-                                    rlocI,
-                                    depends_on_locI,
-                                    allow_recursive_search);
-
-      if (depends_on_locI)
+      int    locI = call_stack.back().first;
+      size_t d    = call_stack.back().second;
+
+      if (d < global_dependencies[locI].size())
       {
-        global_dependencies[locI][c]  = -1;
-        if (locI == chi_mpi.location_id)
-        {
-          auto dependent_location =
-            std::find(sweep_order->location_dependencies.begin(),
-                      sweep_order->location_dependencies.end(),
-                      rlocI);
-          sweep_order->location_dependencies.erase(dependent_location);
-          sweep_order->delayed_location_dependencies.push_back(rlocI);
-        }
+        call_stack.back().second++;
+        int locJ = global_dependencies[locI][d];
 
-        if (rlocI == chi_mpi.location_id)
+        if (component[locJ] != component[locI]) continue;
+
+        if (state[locJ] == ON_PATH)
+          delayed_dependencies.emplace_back(locI,locJ);
+        else if (state[locJ] == NOT_VISITED)
         {
-          sweep_order->delayed_location_successors.push_back(locI);
+          state[locJ] = ON_PATH;
+          call_stack.emplace_back(locJ,0);
         }
+        continue;
       }
 
+      state[locI] = DONE;
+      call_stack.pop_back();
+    }//while call stack
+  }//for root
+
+  //============================================= Update local registers
+  const int location_id = chi_mpi.location_id;
+  for (auto& delayed : delayed_dependencies)
+  {
+    int locI = delayed.first;
+    int locJ = delayed.second;
 
-    }//for locI dependency c
-  }//for locI
-}
\ No newline at end of file
+    if (locI == location_id)
+    {
+      auto& dependencies = sweep_order->location_dependencies;
+      auto dependent_location =
+        std::find(dependencies.begin(),dependencies.end(),locJ);
+      if (dependent_location != dependencies.end())
+        dependencies.erase(dependent_location);
+      sweep_order->delayed_location_dependencies.push_back(locJ);
+    }
+
+    if (locJ == location_id)
+      sweep_order->delayed_location_successors.push_back(locI);
+  }
+
+  return delayed_dependencies;
+}
@@ -17,6 +17,7 @@ namespace sweep_management
   struct SPDS;           ///< Sweep Plane Data Structure
 
   class  SweepBuffer;
+  class  SweepMessageAggregator;
   class AngleSet;
   class AngleSetGroup;
   class  AngleAggregation;
@@ -25,21 +26,23 @@ namespace sweep_management
 
   class SweepScheduler;
 
-  void RecursivelyFindLocIDependency(std::vector<std::vector<int>>& ref_glob_dep,
-                                     std::vector<int>& search_history,
-                                     int master_locI,
-                                     int ref_locI,
-                                     bool& found,
-                                     bool allow_recursive_search= false);
-
   SPDS* CreateSweepOrder(double polar, double azimuthal,
                          chi_mesh::MeshContinuum *grid,
-                         bool allow_cycles=false);
+                         bool allow_cycles=false,
+                         bool level_ordering=false);
+
+  std::vector<std::vector<int>> GatherGlobalDependencies(
+    const std::vector<int>& location_dependencies);
+
+  long long ComputeBottomLevel(SPDS* sweep_order);
+
+  std::vector<int> FindStronglyConnectedLocations(
+    const std::vector<std::vector<int>>& global_dependencies,
+    int& num_components);
 
-  void RemoveGlobalCyclicDependencies(
+  std::vector<std::pair<int,int>> RemoveGlobalCyclicDependencies(
     chi_mesh::sweep_management::SPDS* sweep_order,
-    std::vector<std::vector<int>>& global_dependencies,
-    bool allow_recursive_search=false);
+    const std::vector<std::vector<int>>& global_dependencies);
 
   void PopulateCellRelationships(
             chi_mesh::MeshContinuum *grid,
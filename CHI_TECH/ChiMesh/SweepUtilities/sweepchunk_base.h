@@ -11,6 +11,8 @@ public:
   bool                        suppress_surface_src;
 
 public:
+  virtual ~SweepChunk() = default;
+
   /**Sets the location where flux moments are to be written.*/
   void SetDestinationPhi(std::vector<double>* destination_phi)
   {
@@ -23,6 +25,14 @@ public:
   {
 
   }
+
+  /**Returns a new chunk, with its own scratch space, that can execute
+   * concurrently with this one. Threaded sweep schedulers require this.
+   * Chunks that do not support it return nullptr.*/
+  virtual SweepChunk* CreateWorkerCopy()
+  {
+    return nullptr;
+  }
 };
 
 #endif
\ No newline at end of file
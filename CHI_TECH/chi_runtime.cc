@@ -94,9 +94,10 @@ int ChiTechInitialize(int argc, char** argv)
 {
   ChiTechParseArguments(argc, argv);
   
-  int location_id, number_processes;
+  int location_id, number_processes, thread_support;
 
-  MPI_Init (&argc, &argv);                           /* starts MPI */
+  /* starts MPI. Only the main thread makes MPI calls (threaded sweeps) */
+  MPI_Init_thread(&argc, &argv, MPI_THREAD_FUNNELED, &thread_support);
   MPI_Comm_rank (MPI_COMM_WORLD, &location_id);      /* get current process id */
   MPI_Comm_size (MPI_COMM_WORLD, &number_processes); /* get number of processes */
 
@@ -8,7 +8,13 @@
 #include "../Boundaries/chi_diffusion_bndry_robin.h"
 
 //###################################################################
-/**Assembles PWLC matrix for general cells.*/
+/**Assembles PWLC matrix for general cells.
+ *
+ * The volume entries are accumulated in a dense cell block that is
+ * inserted with a single MatSetValues call. Rows and columns of
+ * Dirichlet nodes are given negative indices, which PETSc ignores, the
+ * Dirichlet rows and the lifted column contributions are applied by
+ * ApplyDirichletI and ApplyDirichletJ.*/
 void chi_diffusion::Solver::CFEM_Assemble_A_and_b(int cell_glob_index,
                                                   chi_mesh::Cell *cell,
                                                   int group)
@@ -24,39 +30,55 @@ void chi_diffusion::Solver::CFEM_Assemble_A_and_b(int cell_glob_index,
 
   GetMaterialProperties(mat_id,cell_glob_index,fe_view->dofs,D,q,siga,group);
 
-  //========================================= Loop over DOFs
-  for (int i=0; i<fe_view->dofs; i++)
+  //====================================== Cell block
+  //The Dirichlet status of a node is the same whether it is a
+  //row or a column.
+  const int dofs = fe_view->dofs;
+  std::vector<PetscInt> cell_nodes(dofs);
+  std::vector<PetscInt> cell_rows(dofs);
+  std::vector<double>   cell_matrix(dofs*dofs,0.0);
+  std::vector<double>   cell_rhs(dofs,0.0);
+  for (int i=0; i<dofs; i++)
   {
     int ir = mesher->MapNode(cell->vertex_ids[i]);
 
     int ir_boundary_type;
-    if (!ApplyDirichletI(ir,&ir_boundary_type))
+    cell_nodes[i] = ir;
+    cell_rows[i]  = (ApplyDirichletI(ir,&ir_boundary_type))? -1 : ir;
+  }
+
+  //========================================= Loop over DOFs
+  for (int i=0; i<dofs; i++)
+  {
+    int ir = cell_rows[i];
+    if (ir < 0) continue;
+
+    //====================== Develop matrix entry
+    for (int j=0; j<dofs; j++)
     {
-      //====================== Develop matrix entry
-      for (int j=0; j<fe_view->dofs; j++)
-      {
-        int jr =  mesher->MapNode(cell->vertex_ids[j]);
-        double jr_mat_entry =
-          D[j]*fe_view->IntV_gradShapeI_gradShapeJ[i][j];
+      double jr_mat_entry =
+        D[j]*fe_view->IntV_gradShapeI_gradShapeJ[i][j];
 
-        jr_mat_entry +=
-          siga[j]*fe_view->IntV_shapeI_shapeJ[i][j];
+      jr_mat_entry +=
+        siga[j]*fe_view->IntV_shapeI_shapeJ[i][j];
 
+      if (cell_rows[j] >= 0)
+        cell_matrix[i*dofs+j] += jr_mat_entry;
+      else
+      {
         int jr_boundary_type;
-        if (!ApplyDirichletJ(jr,ir,jr_mat_entry,&jr_boundary_type))
-        {
-          MatSetValue(Aref,ir,jr,jr_mat_entry,ADD_VALUES);
-        }
-      }//for j
-
-      //====================== Develop RHS entry
-      double rhsvalue =0.0;
-      rhsvalue = q[i]*fe_view->IntV_shapeI[i];
-      VecSetValue(bref,ir,rhsvalue,ADD_VALUES);
-    }//if ir not dirichlet
+        ApplyDirichletJ(cell_nodes[j],ir,jr_mat_entry,&jr_boundary_type);
+      }
+    }//for j
 
+    //====================== Develop RHS entry
+    cell_rhs[i] = q[i]*fe_view->IntV_shapeI[i];
   }//for i
 
+  MatSetValues(Aref,dofs,cell_rows.data(),dofs,cell_rows.data(),
+               cell_matrix.data(),ADD_VALUES);
+  VecSetValues(bref,dofs,cell_rows.data(),cell_rhs.data(),ADD_VALUES);
+
   //======================================== Apply Vacuum, Neumann and Robin
   //                                         BCs
   for (int f=0; f<cell->faces.size(); f++)
@@ -73,27 +95,32 @@ void chi_diffusion::Solver::CFEM_Assemble_A_and_b(int cell_glob_index,
         auto robin_bndry =
           (chi_diffusion::BoundaryRobin*)boundaries[ir_boundary_index];
 
+        std::vector<PetscInt> face_nodes(num_face_dofs);
+        std::vector<double>   face_matrix(num_face_dofs*num_face_dofs,0.0);
         for (int fi=0; fi<num_face_dofs; fi++)
         {
           int i  = fe_view->face_dof_mappings[f][fi];
-          int ir = mesher->MapNode(cell->vertex_ids[i]);
+          face_nodes[fi] = cell_nodes[i];
 
           for (int fj=0; fj<num_face_dofs; fj++)
           {
             int j  = fe_view->face_dof_mappings[f][fj];
-            int jr = mesher->MapNode(cell->vertex_ids[j]);
 
             double aij = robin_bndry->a*fe_view->IntS_shapeI_shapeJ[f][i][j];
             aij /= robin_bndry->b;
 
-            MatSetValue(Aref,ir ,jr, aij,ADD_VALUES);
+            face_matrix[fi*num_face_dofs+fj] += aij;
           }//for fj
 
           double aii = robin_bndry->f*fe_view->IntS_shapeI[i][f];
           aii /= robin_bndry->b;
 
-          MatSetValue(Aref,ir ,ir, aii,ADD_VALUES);
+          face_matrix[fi*num_face_dofs+fi] += aii;
         }//for fi
+
+        MatSetValues(Aref,num_face_dofs,face_nodes.data(),
+                     num_face_dofs,face_nodes.data(),
+                     face_matrix.data(),ADD_VALUES);
       }//if vacuum
     }//if boundary
 
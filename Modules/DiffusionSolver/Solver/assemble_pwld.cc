@@ -10,7 +10,12 @@
 extern ChiLog chi_log;
 
 //###################################################################
-/**Assembles PWLC matrix for polygon cells.*/
+/**Assembles the PWLD MIP matrix and rhs contributions of a cell.
+ *
+ * The entries are accumulated in a dense cell block (cell dofs by cell
+ * dofs) and, for every interior face, in a dense coupling block (cell
+ * dofs by adjacent cell dofs). Each block is handed to PETSc with a
+ * single MatSetValues call instead of one call per entry.*/
 void chi_diffusion::Solver::PWLD_Assemble_A_and_b(int cell_glob_index,
                                                   chi_mesh::Cell *cell,
                                                   DiffusionIPCellView* cell_ip_view,
@@ -27,29 +32,35 @@ void chi_diffusion::Solver::PWLD_Assemble_A_and_b(int cell_glob_index,
 
   GetMaterialProperties(mat_id,cell_glob_index,fe_view->dofs,D,q,siga,group);
 
+  //====================================== Cell block
+  const int dofs = fe_view->dofs;
+  std::vector<PetscInt> cell_rows(dofs);
+  std::vector<double>   cell_matrix(dofs*dofs,0.0);
+  std::vector<double>   cell_rhs(dofs,0.0);
+  for (int i=0; i<dofs; i++)
+    cell_rows[i] = cell_ip_view->MapDof(i);
+
   //========================================= Loop over DOFs
-  for (int i=0; i<fe_view->dofs; i++)
+  for (int i=0; i<dofs; i++)
   {
-    int ir = cell_ip_view->MapDof(i);
     double rhsvalue =0.0;
 
     //====================== Develop matrix entry
-    for (int j=0; j<fe_view->dofs; j++)
+    for (int j=0; j<dofs; j++)
     {
-      int jr =  cell_ip_view->MapDof(j);
       double jr_mat_entry =
         D[j]*fe_view->IntV_gradShapeI_gradShapeJ[i][j];
 
       jr_mat_entry +=
         siga[j]*fe_view->IntV_shapeI_shapeJ[i][j];
 
-      MatSetValue(Aref,ir,jr,jr_mat_entry,ADD_VALUES);
+      cell_matrix[i*dofs+j] += jr_mat_entry;
 
       rhsvalue += q[j]*fe_view->IntV_shapeI_shapeJ[i][j];
     }//for j
 
     //====================== Apply RHS entry
-    VecSetValue(bref,ir,rhsvalue,ADD_VALUES);
+    cell_rhs[i] += rhsvalue;
 
   }//for i
 
@@ -146,23 +157,27 @@ void chi_diffusion::Solver::PWLD_Assemble_A_and_b(int cell_glob_index,
       if (cell->Type() == chi_mesh::CellType::POLYHEDRON)
         kappa = fmax(4.0*(adj_D_avg/hp + D_avg/hm),0.25);
 
+      //========================= Coupling block
+      const int adj_dofs = adj_fe_view->dofs;
+      std::vector<PetscInt> adj_cols(adj_dofs);
+      std::vector<double>   face_matrix(dofs*adj_dofs,0.0);
+      for (int jmap=0; jmap<adj_dofs; jmap++)
+        adj_cols[jmap] = adj_ip_view->MapDof(jmap);
+
       //========================= Assembly penalty terms
       for (int fi=0; fi<num_face_dofs; fi++)
       {
         int i  = fe_view->face_dof_mappings[f][fi];
-        int ir = cell_ip_view->MapDof(i);
 
         for (int fj=0; fj<num_face_dofs; fj++)
         {
           int j     = fe_view->face_dof_mappings[f][fj];
-          int jr    = cell_ip_view->MapDof(j);
           int jmap  = MapCellDof(adj_cell,cell->faces[f].vertex_ids[fj]);
-          int jrmap = adj_ip_view->MapDof(jmap);
 
           double aij = kappa*fe_view->IntS_shapeI_shapeJ[f][i][j];
 
-          MatSetValue(Aref,ir    ,jr   , aij,ADD_VALUES);
-          MatSetValue(Aref,ir    ,jrmap,-aij,ADD_VALUES);
+          cell_matrix[i*dofs    +j   ] += aij;
+          face_matrix[i*adj_dofs+jmap] -= aij;
         }//for fj
 
       }//for fi
@@ -174,20 +189,16 @@ void chi_diffusion::Solver::PWLD_Assemble_A_and_b(int cell_glob_index,
 
       // -Di^- bj^- and
       // -Dj^- bi^-
-      for (int i=0; i<fe_view->dofs; i++)
+      for (int i=0; i<dofs; i++)
       {
-        int ir = cell_ip_view->MapDof(i);
-
-        for (int j=0; j<fe_view->dofs; j++)
+        for (int j=0; j<dofs; j++)
         {
-          int jr = cell_ip_view->MapDof(j);
-
           double gij =
             n.Dot(fe_view->IntS_shapeI_gradshapeJ[f][i][j] +
                   fe_view->IntS_shapeI_gradshapeJ[f][j][i]);
           double aij = -0.5*D_avg*gij;
 
-          MatSetValue(Aref,ir,jr,aij,ADD_VALUES);
+          cell_matrix[i*dofs+j] += aij;
         }//for j
       }//for i
 
@@ -216,17 +227,14 @@ void chi_diffusion::Solver::PWLD_Assemble_A_and_b(int cell_glob_index,
       {
         int j     = MapCellDof(cell,cell->faces[f].vertex_ids[fj]);
         int jmap  = MapCellDof(adj_cell,cell->faces[f].vertex_ids[fj]);
-        int jrmap = adj_ip_view->MapDof(jmap);
 
-        for (int i=0; i<fe_view->dofs; i++)
+        for (int i=0; i<dofs; i++)
         {
-          int ir = cell_ip_view->MapDof(i);
-
           double gij =
             n.Dot(fe_view->IntS_shapeI_gradshapeJ[f][j][i]);
           double aij = 0.5*D_avg*gij;
 
-          MatSetValue(Aref,ir,jrmap,aij,ADD_VALUES);
+          face_matrix[i*adj_dofs+jmap] += aij;
         }//for i
       }//for fj
 
@@ -237,20 +245,20 @@ void chi_diffusion::Solver::PWLD_Assemble_A_and_b(int cell_glob_index,
       {
         int imap  = MapCellDof(adj_cell,cell->faces[f].vertex_ids[fi]);
         int i     = MapCellDof(cell,cell->faces[f].vertex_ids[fi]);
-        int ir    = cell_ip_view->MapDof(i);
 
-        for (int jmap=0; jmap<adj_fe_view->dofs; jmap++)
+        for (int jmap=0; jmap<adj_dofs; jmap++)
         {
-          int jrmap = adj_ip_view->MapDof(jmap);
-
           double gij =
             n.Dot(adj_fe_view->IntS_shapeI_gradshapeJ[fmap][imap][jmap]);
           double aij = -0.5*adj_D_avg*gij;
 
-          MatSetValue(Aref,ir,jrmap,aij,ADD_VALUES);
+          face_matrix[i*adj_dofs+jmap] += aij;
         }//for j
       }//for i
 
+      MatSetValues(Aref,dofs,cell_rows.data(),adj_dofs,adj_cols.data(),
+                   face_matrix.data(),ADD_VALUES);
+
 //      for (int fi=0; fi<num_face_dofs; fi++)
 //      {
 //        int i    = MapCellDof(polyh_cell,polyh_cell->faces[f]->v_indices[fi]);
@@ -325,17 +333,15 @@ void chi_diffusion::Solver::PWLD_Assemble_A_and_b(int cell_glob_index,
         for (int fi=0; fi<num_face_dofs; fi++)
         {
           int i  = fe_view->face_dof_mappings[f][fi];
-          int ir = cell_ip_view->MapDof(i);
 
           for (int fj=0; fj<num_face_dofs; fj++)
           {
             int j  = fe_view->face_dof_mappings[f][fj];
-            int jr = cell_ip_view->MapDof(j);
 
             double aij = kappa*fe_view->IntS_shapeI_shapeJ[f][i][j];
 
-            MatSetValue(Aref,ir    ,jr, aij,ADD_VALUES);
-            VecSetValue(bref,ir,aij*dc_boundary->boundary_value,ADD_VALUES);
+            cell_matrix[i*dofs+j] += aij;
+            cell_rhs[i] += aij*dc_boundary->boundary_value;
           }//for fj
 
 //          double rhs = kappa*fe_view->IntS_shapeI[i][f];
@@ -344,21 +350,17 @@ void chi_diffusion::Solver::PWLD_Assemble_A_and_b(int cell_glob_index,
 
         // -Di^- bj^- and
         // -Dj^- bi^-
-        for (int i=0; i<fe_view->dofs; i++)
+        for (int i=0; i<dofs; i++)
         {
-          int ir = cell_ip_view->MapDof(i);
-
-          for (int j=0; j<fe_view->dofs; j++)
+          for (int j=0; j<dofs; j++)
           {
-            int jr = cell_ip_view->MapDof(j);
-
             double gij =
               n.Dot(fe_view->IntS_shapeI_gradshapeJ[f][i][j] +
                     fe_view->IntS_shapeI_gradshapeJ[f][j][i]);
             double aij = -0.5*D_avg*gij;
 
-            MatSetValue(Aref,ir,jr,aij,ADD_VALUES);
-            VecSetValue(bref,ir,aij*dc_boundary->boundary_value,ADD_VALUES);
+            cell_matrix[i*dofs+j] += aij;
+            cell_rhs[i] += aij*dc_boundary->boundary_value;
           }//for j
         }//for i
       }//Dirichlet
@@ -370,31 +372,34 @@ void chi_diffusion::Solver::PWLD_Assemble_A_and_b(int cell_glob_index,
         for (int fi=0; fi<num_face_dofs; fi++)
         {
           int i  = fe_view->face_dof_mappings[f][fi];
-          int ir =  cell_ip_view->MapDof(i);
 
           for (int fj=0; fj<num_face_dofs; fj++)
           {
             int j  = fe_view->face_dof_mappings[f][fj];
-            int jr =  cell_ip_view->MapDof(j);
 
             double aij = robin_bndry->a*fe_view->IntS_shapeI_shapeJ[f][i][j];
             aij /= robin_bndry->b;
 
-            MatSetValue(Aref,ir ,jr, aij,ADD_VALUES);
+            cell_matrix[i*dofs+j] += aij;
           }//for fj
 
           double aii = robin_bndry->f*fe_view->IntS_shapeI[i][f];
           aii /= robin_bndry->b;
 
-          MatSetValue(Aref,ir ,ir, aii,ADD_VALUES);
+          cell_matrix[i*dofs+i] += aii;
         }//for fi
       }//robin
     }
   }//for f
+
+  //========================================= Insert cell block
+  MatSetValues(Aref,dofs,cell_rows.data(),dofs,cell_rows.data(),
+               cell_matrix.data(),ADD_VALUES);
+  VecSetValues(bref,dofs,cell_rows.data(),cell_rhs.data(),ADD_VALUES);
 }
 
 //###################################################################
-/**Assembles PWLC matrix for polygon cells.*/
+/**Assembles the PWLD MIP rhs contributions of a cell.*/
 void chi_diffusion::Solver::PWLD_Assemble_b(int cell_glob_index,
                                             chi_mesh::Cell *cell,
                                             DiffusionIPCellView* cell_ip_view,
@@ -411,27 +416,20 @@ void chi_diffusion::Solver::PWLD_Assemble_b(int cell_glob_index,
 
   GetMaterialProperties(mat_id,cell_glob_index,fe_view->dofs,D,q,siga,group);
 
+  const int dofs = fe_view->dofs;
+  std::vector<PetscInt> cell_rows(dofs);
+  std::vector<double>   cell_rhs(dofs,0.0);
+
   //========================================= Loop over DOFs
-  for (int i=0; i<fe_view->dofs; i++)
+  for (int i=0; i<dofs; i++)
   {
-    int ir = cell_ip_view->MapDof(i);
-    int ig = cell->vertex_ids[i];
-    double rhsvalue =0.0;
-
-    int ir_boundary_type;
-    //if (!ApplyDirichletI(ir,&ir_boundary_type,ig,true))
-    {
-      //====================== Develop matrix entry
-      for (int j=0; j<fe_view->dofs; j++)
-      {
-        rhsvalue += q[j]*fe_view->IntV_shapeI_shapeJ[i][j];
-      }//for j
-
-      //====================== Apply RHS entry
-      VecSetValue(bref,ir,rhsvalue,ADD_VALUES);
-    }//if ir not dirichlet
+    cell_rows[i] = cell_ip_view->MapDof(i);
 
+    //====================== Develop rhs entry
+    for (int j=0; j<dofs; j++)
+      cell_rhs[i] += q[j]*fe_view->IntV_shapeI_shapeJ[i][j];
   }//for i
 
+  VecSetValues(bref,dofs,cell_rows.data(),cell_rhs.data(),ADD_VALUES);
 
 }
\ No newline at end of file
@@ -8,11 +8,16 @@
 
 #include <chi_log.h>
 
+#include <algorithm>
+
 extern ChiLog chi_log;
 
 
 //###################################################################
-/**Assembles PWLC matrix for polygon cells.*/
+/**Assembles the group aggregated PWLD MIP matrix and rhs contributions
+ * of a cell. Groups do not couple, hence for every group the entries are
+ * accumulated in a dense cell block and dense face coupling blocks that
+ * are each inserted with a single MatSetValues call.*/
 void chi_diffusion::Solver::PWLD_Assemble_A_and_b_GAGG(
                                                int cell_glob_index,
                                                chi_mesh::Cell *cell,
@@ -20,6 +25,11 @@ void chi_diffusion::Solver::PWLD_Assemble_A_and_b_GAGG(
 {
   auto fe_view = (CellFEView*)pwl_discr->MapFeView(cell_glob_index);
 
+  const int dofs = fe_view->dofs;
+  std::vector<PetscInt> cell_rows(dofs);
+  std::vector<double>   cell_matrix(dofs*dofs);
+  std::vector<double>   cell_rhs(dofs);
+
   for (int gr=0; gr<G; gr++)
   {
     //====================================== Process material id
@@ -31,40 +41,33 @@ void chi_diffusion::Solver::PWLD_Assemble_A_and_b_GAGG(
 
     GetMaterialProperties(mat_id,cell_glob_index,fe_view->dofs,D,q,siga,gi+gr);
 
+    //====================================== Cell block of this group
+    for (int i=0; i<dofs; i++)
+      cell_rows[i] = cell_ip_view->MapDof(i)*G+gr;
+    std::fill(cell_matrix.begin(),cell_matrix.end(),0.0);
+    std::fill(cell_rhs.begin(),cell_rhs.end(),0.0);
+
     //========================================= Loop over DOFs
-    for (int i=0; i<fe_view->dofs; i++)
+    for (int i=0; i<dofs; i++)
     {
-      int ir = cell_ip_view->MapDof(i);
-      int ig = cell->vertex_ids[i];
       double rhsvalue =0.0;
 
-      int ir_boundary_type;
-      //if (!ApplyDirichletI(ir*G+gr,&ir_boundary_type,ig))
+      //====================== Develop matrix entry
+      for (int j=0; j<dofs; j++)
       {
-        //====================== Develop matrix entry
-        for (int j=0; j<fe_view->dofs; j++)
-        {
-          int jr =  cell_ip_view->MapDof(j);
-          int jg = cell->vertex_ids[j];
-          double jr_mat_entry =
-            D[j]*fe_view->IntV_gradShapeI_gradShapeJ[i][j];
-
-          jr_mat_entry +=
-            siga[j]*fe_view->IntV_shapeI_shapeJ[i][j];
+        double jr_mat_entry =
+          D[j]*fe_view->IntV_gradShapeI_gradShapeJ[i][j];
 
-          int jr_boundary_type;
-          //if (!ApplyDirichletJ(jr*G+gr,ir*G+gr,jr_mat_entry,&jr_boundary_type,jg))
-          {
-            MatSetValue(Aref,ir*G+gr,jr*G+gr,jr_mat_entry,ADD_VALUES);
-          }
+        jr_mat_entry +=
+          siga[j]*fe_view->IntV_shapeI_shapeJ[i][j];
 
-          rhsvalue += q[j]*fe_view->IntV_shapeI_shapeJ[i][j];
-        }//for j
+        cell_matrix[i*dofs+j] += jr_mat_entry;
 
-        //====================== Apply RHS entry
-        VecSetValue(bref,ir*G+gr,rhsvalue,ADD_VALUES);
-      }//if ir not dirichlet
+        rhsvalue += q[j]*fe_view->IntV_shapeI_shapeJ[i][j];
+      }//for j
 
+      //====================== Apply RHS entry
+      cell_rhs[i] += rhsvalue;
     }//for i
 
 
@@ -160,23 +163,27 @@ void chi_diffusion::Solver::PWLD_Assemble_A_and_b_GAGG(
         if (cell->Type() == chi_mesh::CellType::POLYHEDRON)
           kappa = fmax(4.0*(adj_D_avg/hp + D_avg/hm),0.25);
 
+        //========================= Coupling block
+        const int adj_dofs = adj_fe_view->dofs;
+        std::vector<PetscInt> adj_cols(adj_dofs);
+        std::vector<double>   face_matrix(dofs*adj_dofs,0.0);
+        for (int jmap=0; jmap<adj_dofs; jmap++)
+          adj_cols[jmap] = adj_ip_view->MapDof(jmap)*G+gr;
+
         //========================= Assembly penalty terms
         for (int fi=0; fi<num_face_dofs; fi++)
         {
           int i  = fe_view->face_dof_mappings[f][fi];
-          int ir = cell_ip_view->MapDof(i);
 
           for (int fj=0; fj<num_face_dofs; fj++)
           {
             int j  = fe_view->face_dof_mappings[f][fj];
-            int jr = cell_ip_view->MapDof(j);
             int jmap  = MapCellDof(adj_cell, cell->faces[f].vertex_ids[fj]);
-            int jrmap = adj_ip_view->MapDof(jmap);
 
             double aij = kappa*fe_view->IntS_shapeI_shapeJ[f][i][j];
 
-            MatSetValue(Aref,ir*G+gr,jr   *G+gr, aij,ADD_VALUES);
-            MatSetValue(Aref,ir*G+gr,jrmap*G+gr,-aij,ADD_VALUES);
+            cell_matrix[i*dofs    +j   ] += aij;
+            face_matrix[i*adj_dofs+jmap] -= aij;
           }//for fj
 
         }//for fi
@@ -188,20 +195,16 @@ void chi_diffusion::Solver::PWLD_Assemble_A_and_b_GAGG(
 
         // -Di^- bj^- and
         // -Dj^- bi^-
-        for (int i=0; i<fe_view->dofs; i++)
+        for (int i=0; i<dofs; i++)
         {
-          int ir = cell_ip_view->MapDof(i);
-
-          for (int j=0; j<fe_view->dofs; j++)
+          for (int j=0; j<dofs; j++)
           {
-            int jr = cell_ip_view->MapDof(j);
-
             double gij =
               n.Dot(fe_view->IntS_shapeI_gradshapeJ[f][i][j] +
                     fe_view->IntS_shapeI_gradshapeJ[f][j][i]);
             double aij = -0.5*D_avg*gij;
 
-            MatSetValue(Aref,ir*G+gr,jr*G+gr,aij,ADD_VALUES);
+            cell_matrix[i*dofs+j] += aij;
           }//for j
         }//for i
 
@@ -230,17 +233,14 @@ void chi_diffusion::Solver::PWLD_Assemble_A_and_b_GAGG(
         {
           int j     = MapCellDof(cell, cell->faces[f].vertex_ids[fj]);
           int jmap  = MapCellDof(adj_cell, cell->faces[f].vertex_ids[fj]);
-          int jrmap = adj_ip_view->MapDof(jmap);
 
-          for (int i=0; i<fe_view->dofs; i++)
+          for (int i=0; i<dofs; i++)
           {
-            int ir = cell_ip_view->MapDof(i);
-
             double gij =
               n.Dot(fe_view->IntS_shapeI_gradshapeJ[f][j][i]);
             double aij = 0.5*D_avg*gij;
 
-            MatSetValue(Aref,ir*G+gr,jrmap*G+gr,aij,ADD_VALUES);
+            face_matrix[i*adj_dofs+jmap] += aij;
           }//for i
         }//for fj
 
@@ -250,20 +250,20 @@ void chi_diffusion::Solver::PWLD_Assemble_A_and_b_GAGG(
         {
           int imap  = MapCellDof(adj_cell, cell->faces[f].vertex_ids[fi]);
           int i     = MapCellDof(cell, cell->faces[f].vertex_ids[fi]);
-          int ir    = cell_ip_view->MapDof(i);
 
-          for (int jmap=0; jmap<adj_fe_view->dofs; jmap++)
+          for (int jmap=0; jmap<adj_dofs; jmap++)
           {
-            int jrmap = adj_ip_view->MapDof(jmap);
-
             double gij =
               n.Dot(adj_fe_view->IntS_shapeI_gradshapeJ[fmap][imap][jmap]);
             double aij = -0.5*adj_D_avg*gij;
 
-            MatSetValue(Aref,ir*G+gr,jrmap*G+gr,aij,ADD_VALUES);
+            face_matrix[i*adj_dofs+jmap] += aij;
           }//for j
         }//for i
 
+        MatSetValues(Aref,dofs,cell_rows.data(),adj_dofs,adj_cols.data(),
+                     face_matrix.data(),ADD_VALUES);
+
 
       }//if not bndry
       else
@@ -300,36 +300,30 @@ void chi_diffusion::Solver::PWLD_Assemble_A_and_b_GAGG(
           for (int fi=0; fi<num_face_dofs; fi++)
           {
             int i  = fe_view->face_dof_mappings[f][fi];
-            int ir = cell_ip_view->MapDof(i);
 
             for (int fj=0; fj<num_face_dofs; fj++)
             {
               int j  = fe_view->face_dof_mappings[f][fj];
-              int jr = cell_ip_view->MapDof(j);
 
               double aij = kappa*fe_view->IntS_shapeI_shapeJ[f][i][j];
 
-              MatSetValue(Aref,ir*G+gr,jr*G+gr, aij,ADD_VALUES);
+              cell_matrix[i*dofs+j] += aij;
             }//for fj
 
           }//for fi
 
           // -Di^- bj^- and
           // -Dj^- bi^-
-          for (int i=0; i<fe_view->dofs; i++)
+          for (int i=0; i<dofs; i++)
           {
-            int ir = cell_ip_view->MapDof(i);
-
-            for (int j=0; j<fe_view->dofs; j++)
+            for (int j=0; j<dofs; j++)
             {
-              int jr = cell_ip_view->MapDof(j);
-
               double gij =
                 n.Dot(fe_view->IntS_shapeI_gradshapeJ[f][i][j] +
                       fe_view->IntS_shapeI_gradshapeJ[f][j][i]);
               double aij = -0.5*D_avg*gij;
 
-              MatSetValue(Aref,ir*G+gr,jr*G+gr,aij,ADD_VALUES);
+              cell_matrix[i*dofs+j] += aij;
             }//for j
           }//for i
         }//Dirichlet
@@ -341,32 +335,35 @@ void chi_diffusion::Solver::PWLD_Assemble_A_and_b_GAGG(
           for (int fi=0; fi<num_face_dofs; fi++)
           {
             int i  = fe_view->face_dof_mappings[f][fi];
-            int ir =  cell_ip_view->MapDof(i);
 
             for (int fj=0; fj<num_face_dofs; fj++)
             {
               int j  = fe_view->face_dof_mappings[f][fj];
-              int jr =  cell_ip_view->MapDof(j);
 
               double aij = robin_bndry->a*fe_view->IntS_shapeI_shapeJ[f][i][j];
               aij /= robin_bndry->b;
 
-              MatSetValue(Aref,ir*G+gr,jr*G+gr, aij,ADD_VALUES);
+              cell_matrix[i*dofs+j] += aij;
             }//for fj
 
             double aii = robin_bndry->f*fe_view->IntS_shapeI[i][f];
             aii /= robin_bndry->b;
 
-            MatSetValue(Aref,ir*G+gr,ir*G+gr, aii,ADD_VALUES);
+            cell_matrix[i*dofs+i] += aii;
           }//for fi
         }//robin
       }
     }//for f
+
+    //========================================= Insert cell block
+    MatSetValues(Aref,dofs,cell_rows.data(),dofs,cell_rows.data(),
+                 cell_matrix.data(),ADD_VALUES);
+    VecSetValues(bref,dofs,cell_rows.data(),cell_rhs.data(),ADD_VALUES);
   }//for gr
 }
 
 //###################################################################
-/**Assembles b PWLD for polygon cells.*/
+/**Assembles the group aggregated PWLD MIP rhs contributions of a cell.*/
 void chi_diffusion::Solver::PWLD_Assemble_b_GAGG(
                                                int cell_glob_index,
                                                chi_mesh::Cell *cell,
@@ -374,6 +371,10 @@ void chi_diffusion::Solver::PWLD_Assemble_b_GAGG(
 {
   auto fe_view = (CellFEView*)pwl_discr->MapFeView(cell_glob_index);
 
+  const int dofs = fe_view->dofs;
+  std::vector<PetscInt> cell_rows(dofs);
+  std::vector<double>   cell_rhs(dofs);
+
   for (int gr=0; gr<G; gr++)
   {
     //====================================== Process material id
@@ -386,26 +387,17 @@ void chi_diffusion::Solver::PWLD_Assemble_b_GAGG(
     GetMaterialProperties(mat_id,cell_glob_index,fe_view->dofs,D,q,siga,gi+gr);
 
     //========================================= Loop over DOFs
-    for (int i=0; i<fe_view->dofs; i++)
+    for (int i=0; i<dofs; i++)
     {
-      int ir = cell_ip_view->MapDof(i);
-      int ig = cell->vertex_ids[i];
-      double rhsvalue =0.0;
-
-      int ir_boundary_type;
-      //if (!ApplyDirichletI(ir*G+gr,&ir_boundary_type,ig,true))
-      {
-        //====================== Develop matrix entry
-        for (int j=0; j<fe_view->dofs; j++)
-        {
-          rhsvalue += q[j]*fe_view->IntV_shapeI_shapeJ[i][j];
-        }//for j
-
-        //====================== Apply RHS entry
-        VecSetValue(bref,ir*G+gr,rhsvalue,ADD_VALUES);
-      }//if ir not dirichlet
+      cell_rows[i] = cell_ip_view->MapDof(i)*G+gr;
+      cell_rhs[i]  = 0.0;
 
+      //====================== Develop rhs entry
+      for (int j=0; j<dofs; j++)
+        cell_rhs[i] += q[j]*fe_view->IntV_shapeI_shapeJ[i][j];
     }//for i
+
+    VecSetValues(bref,dofs,cell_rows.data(),cell_rhs.data(),ADD_VALUES);
   }//for gr
 
 }
\ No newline at end of file
@@ -24,6 +24,13 @@ chi_diffusion::Solver::Solver()
   q_field = nullptr;
   sigma_field = nullptr;
 
+  operator_ready = false;
+  reuse_initial_guess = false;
+  time_operator_setup = 0.0;
+  time_operator_apply = 0.0;
+  num_operator_applies = 0;
+  num_operator_iterations = 0;
+
 }
 
 chi_diffusion::Solver::Solver(std::string in_solver_name):Solver()
@@ -40,6 +47,8 @@ chi_diffusion::Solver::~Solver()
   VecDestroy(&b);
   MatDestroy(&A);
   KSPDestroy(&ksp);
+  if (operator_ready)
+    VecDestroy(&operator_work);
 
   for (auto ip_cell_view : ip_cell_views)
     delete ip_cell_view;
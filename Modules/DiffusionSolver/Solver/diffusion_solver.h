@@ -75,6 +75,7 @@ private:
   ChiTimer t_solve;
 
   double time_assembly, time_solve;
+  double time_assembly_local; ///< Element block part of time_assembly
   bool verbose_info;
 public:
   std::string                              solver_name;
@@ -139,6 +140,15 @@ public:
   int    G;
   std::string options_string;
 
+  //Operator mode
+  bool   operator_ready;
+  bool   reuse_initial_guess;
+  Vec    operator_work;
+  double time_operator_setup;
+  double time_operator_apply;
+  int    num_operator_applies;
+  int    num_operator_iterations;
+
 public:
   //00
   Solver();
@@ -214,6 +224,11 @@ public:
   void PWLD_Assemble_b_GAGG(int cell_glob_index, chi_mesh::Cell *cell,
                               DiffusionIPCellView* cell_ip_view);
 
+  //02f
+  int  SetupOperator(bool verbose=true);
+  int  ApplyOperatorInverse();
+  void PrintOperatorTimings();
+
 
 
 
@@ -0,0 +1,167 @@
+#include "diffusion_solver.h"
+
+#include <ChiTimer/chi_timer.h>
+
+#include <chi_mpi.h>
+#include <chi_log.h>
+
+extern ChiMPI chi_mpi;
+extern ChiLog chi_log;
+
+extern ChiTimer chi_program_timer;
+
+//###################################################################
+/**Sets the solver up as a fixed operator, as used by the diffusion
+ * synthetic acceleration schemes. The matrix is assembled and the
+ * solver and preconditioner (i.e. the AMG hierarchy) are set up once.
+ * Afterwards ApplyOperatorInverse only assembles the rhs and solves.
+ *
+ * Only the PWLD_MIP and PWLD_MIP_GAGG methods are supported.*/
+int chi_diffusion::Solver::SetupOperator(bool verbose)
+{
+  if ((fem_method != PWLD_MIP) and (fem_method != PWLD_MIP_GAGG))
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << solver_name << ": Operator mode is only supported for the "
+      << "PWLD_MIP and PWLD_MIP_GAGG methods.";
+    exit(EXIT_FAILURE);
+  }
+
+  ChiTimer t_setup; t_setup.Reset();
+
+  Initialize(verbose);
+  ExecuteS(false,true);
+
+  VecDuplicate(x,&operator_work);
+
+  time_operator_setup     = t_setup.GetTime()/1000.0;
+  time_operator_apply     = 0.0;
+  num_operator_applies    = 0;
+  num_operator_iterations = 0;
+  operator_ready          = true;
+
+  return 0;
+}
+
+//###################################################################
+/**Applies the inverse of the operator set up with SetupOperator to the
+ * current source field, the result is stored in pwld_phi_local.
+ *
+ * When reuse_initial_guess is set the previous solution, scaled to
+ * best fit the new rhs in the least squares sense, is used as the
+ * initial guess. Successive corrections are dominated by the same
+ * slowly converging modes and mostly differ in magnitude. The result
+ * then depends on previous applications, hence this must be off when
+ * the inverse is part of an operator applied by a Krylov method.*/
+int chi_diffusion::Solver::ApplyOperatorInverse()
+{
+  if (not operator_ready)
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << solver_name << ": ApplyOperatorInverse called before "
+      << "SetupOperator.";
+    exit(EXIT_FAILURE);
+  }
+
+  ChiTimer t_apply; t_apply.Reset();
+
+  //================================================== Setting references
+  xref = x;
+  bref = b;
+  Aref = A;
+
+  VecSet(bref,0.0);
+
+  //================================================== Assemble rhs
+  size_t num_local_cells = grid->local_cell_glob_indices.size();
+  for (int lc=0; lc<num_local_cells; lc++)
+  {
+    int glob_cell_index = grid->local_cell_glob_indices[lc];
+    chi_mesh::Cell* cell = grid->cells[glob_cell_index];
+
+    DiffusionIPCellView* cell_ip_view = ip_cell_views[lc];
+
+    if (fem_method == PWLD_MIP_GAGG)
+      PWLD_Assemble_b_GAGG(glob_cell_index,cell,cell_ip_view);
+    else
+      PWLD_Assemble_b(glob_cell_index,cell,cell_ip_view,gi);
+  }
+  VecAssemblyBegin(b);
+  VecAssemblyEnd(b);
+
+  //================================================== Initial guess
+  if (reuse_initial_guess and (num_operator_applies > 0))
+  {
+    double Ax_dot_b  = 0.0;
+    double Ax_dot_Ax = 0.0;
+    MatMult(A,x,operator_work);
+    VecDot(operator_work,b,&Ax_dot_b);
+    VecDot(operator_work,operator_work,&Ax_dot_Ax);
+
+    if (Ax_dot_Ax > 0.0)
+      VecScale(x,Ax_dot_b/Ax_dot_Ax);
+    else
+      VecSet(x,0.0);
+  }
+  else
+    VecSet(x,0.0);
+
+  //================================================== Solve
+  KSPSolve(ksp,b,x);
+
+  //=================================== Populate field vector
+  const double* x_ref;
+  VecGetArrayRead(x,&x_ref);
+
+  for (int i=0; i<pwld_local_dof_count*G; i++)
+    pwld_phi_local[i] = x_ref[i];
+
+  VecRestoreArrayRead(x,&x_ref);
+
+  //=================================== Get convergence reason
+  KSPConvergedReason reason;
+  KSPGetConvergedReason(ksp,&reason);
+  if (verbose_info || reason != KSP_CONVERGED_RTOL)
+    chi_log.Log(LOG_0) << "Convergence reason: " << reason;
+
+  PetscInt its;
+  KSPGetIterationNumber(ksp,&its);
+  chi_log.Log(LOG_0)
+    << chi_program_timer.GetTimeString() << " "
+    << solver_name
+    << ": Number of iterations =" << its;
+
+  time_operator_apply     += t_apply.GetTime()/1000.0;
+  num_operator_applies    += 1;
+  num_operator_iterations += its;
+
+  return 0;
+}
+
+//###################################################################
+/**Prints the setup and application timings of the operator.*/
+void chi_diffusion::Solver::PrintOperatorTimings()
+{
+  if (not operator_ready) return;
+
+  double avg_apply_time = 0.0;
+  double avg_iterations = 0.0;
+  if (num_operator_applies > 0)
+  {
+    avg_apply_time = time_operator_apply/num_operator_applies;
+    avg_iterations = double(num_operator_iterations)/num_operator_applies;
+  }
+
+  chi_log.Log(LOG_0)
+    << solver_name << " operator timing:\n"
+    << "        Setup time (s):                "
+    << time_operator_setup << "\n"
+    << "        Number of applications:        "
+    << num_operator_applies << "\n"
+    << "        Total apply time (s):          "
+    << time_operator_apply << "\n"
+    << "        Average apply time (s):        "
+    << avg_apply_time << "\n"
+    << "        Average iterations per apply:  "
+    << avg_iterations;
+}
@@ -58,6 +58,7 @@ int chi_diffusion::Solver::ExecutePWLC(bool suppress_assembly,
     if (!suppress_assembly)
       CFEM_Assemble_A_and_b(glob_cell_index, cell, gi);
   }
+  time_assembly_local = t_assembly.GetTime()/1000.0;
 
   //=================================== Call matrix assembly
   chi_log.Log(LOG_0) << "Diffusion Solver: Communicating matrix assembly";
@@ -114,6 +115,9 @@ int chi_diffusion::Solver::ExecutePWLC(bool suppress_assembly,
       chi_log.Log(LOG_0) << "Diffusion Solver: Number of iterations =" << its;
       chi_log.Log(LOG_0) << "Timing:";
       chi_log.Log(LOG_0) << "Assembling the matrix: " << time_assembly;
+      chi_log.Log(LOG_0) << "  Element blocks     : " << time_assembly_local;
+      chi_log.Log(LOG_0) << "  Global assembly    : "
+                         << time_assembly - time_assembly_local;
       chi_log.Log(LOG_0) << "Solving the system   : " << time_solve;
     }
 
@@ -88,6 +88,7 @@ int chi_diffusion::Solver::ExecutePWLD_MIP(bool suppress_assembly,
     else
       PWLD_Assemble_b(glob_cell_index,cell,cell_ip_view,gi);
   }
+  time_assembly_local = t_assembly.GetTime()/1000.0;
 
   //=================================== Call matrix assembly
   if (verbose_info || chi_log.GetVerbosity() >= LOG_0VERBOSE_1)
@@ -179,6 +180,9 @@ int chi_diffusion::Solver::ExecutePWLD_MIP(bool suppress_assembly,
       {
         chi_log.Log(LOG_0) << "Timing:";
         chi_log.Log(LOG_0) << "Assembling the matrix: " << time_assembly;
+        chi_log.Log(LOG_0) << "  Element blocks     : " << time_assembly_local;
+        chi_log.Log(LOG_0) << "  Global assembly    : "
+                           << time_assembly - time_assembly_local;
         chi_log.Log(LOG_0) << "Solving the system   : " << time_solve;
       }
     }
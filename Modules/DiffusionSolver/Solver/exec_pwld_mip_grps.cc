@@ -82,6 +82,7 @@ int chi_diffusion::Solver::ExecutePWLD_MIP_GRPS(bool suppress_assembly,
         PWLD_Assemble_b(glob_cell_index, cell, cell_ip_view, gi+gr);
     }//for local cell
   }//for gr
+  time_assembly_local = t_assembly.GetTime()/1000.0;
 
 
 
@@ -168,9 +169,15 @@ int chi_diffusion::Solver::ExecutePWLD_MIP_GRPS(bool suppress_assembly,
           << solver_name
           << "[g=" << gi+gr
           << "]: Number of iterations =" << its;
-//        chi_log.Log(LOG_0) << "Timing:";
-//        chi_log.Log(LOG_0) << "Assembling the matrix: " << time_assembly;
-//        chi_log.Log(LOG_0) << "Solving the system   : " << time_solve;
+        if (verbose_info || chi_log.GetVerbosity() >= LOG_0VERBOSE_1)
+        {
+          chi_log.Log(LOG_0) << "Timing:";
+          chi_log.Log(LOG_0) << "Assembling the matrix: " << time_assembly;
+          chi_log.Log(LOG_0) << "  Element blocks     : " << time_assembly_local;
+          chi_log.Log(LOG_0) << "  Global assembly    : "
+                             << time_assembly - time_assembly_local;
+          chi_log.Log(LOG_0) << "Solving the system   : " << time_solve;
+        }
       }
     }//for gr
 
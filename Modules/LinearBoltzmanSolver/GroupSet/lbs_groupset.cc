@@ -1,4 +1,8 @@
 #include "lbs_groupset.h"
+#include "../lbs_linear_boltzman_solver.h"
+
+#include <ChiMesh/SweepUtilities/SweepScheduler/sweepscheduler.h>
+#include "../Tools/krylov_state.h"
 
 #include <ChiMesh/MeshHandler/chi_meshhandler.h>
 #include <ChiMesh/VolumeMesher/Linemesh1D/volmesher_linemesh1d.h>
@@ -41,13 +45,34 @@ LBSGroupset::LBSGroupset()
   wgdsa_verbose = false;
   tgdsa_verbose = false;
 
+  dsa_as_preconditioner = false;
+
+  krylov_reuse = false;
+  krylov_num_guess_vectors = 4;
+  krylov_state = nullptr;
+
   allow_cycles = false;
 
   log_sweep_events = false;
+  single_precision_psi = false;
 
   latest_convergence_metric = 1.0;
 }
 
+//###################################################################
+/**Destroys the Krylov solver, and its stored solutions, kept alive
+ * across executions. Must be called on all locations and before PETSc
+ * is finalized. Solvers are never deleted, hence this is not done
+ * automatically but through chiLBSGroupsetSetKrylovReuse.*/
+void LBSGroupset::DestroyKrylovState()
+{
+  if (krylov_state == nullptr) return;
+
+  krylov_state->Destroy();
+  delete krylov_state;
+  krylov_state = nullptr;
+}
+
 //###################################################################
 /**Computes the discrete to moment operator.*/
 void LBSGroupset::BuildDiscMomOperator(int scatt_order)
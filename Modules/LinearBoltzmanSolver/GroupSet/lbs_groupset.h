@@ -23,6 +23,8 @@ typedef chi_mesh::sweep_management::AngleAggregation AngleAgg;
 typedef std::pair<int,int> GsSubSet;
 typedef std::pair<int,int> AngSubSet;
 
+struct LBSKrylovState;
+
 #include <vector>
 
 //################################################################### Class def
@@ -59,6 +61,11 @@ public:
   bool                                         tgdsa_verbose;
   std::string                                  wgdsa_string;
   std::string                                  tgdsa_string;
+  bool                                         dsa_as_preconditioner;
+
+  bool                                         krylov_reuse;
+  int                                          krylov_num_guess_vectors;
+  LBSKrylovState*                              krylov_state;
 
   bool                                         allow_cycles;
 
@@ -67,11 +74,13 @@ public:
   std::vector<int>                             wgdsa_cell_dof_array_address;
 
   bool                                         log_sweep_events;
+  bool                                         single_precision_psi;
 
   double                                       latest_convergence_metric;
 
   //npt_groupset.cc
        LBSGroupset();
+  void DestroyKrylovState();
   void BuildDiscMomOperator(int scatt_order);
   void BuildMomDiscOperator(int scatt_order);
   void BuildSubsets();
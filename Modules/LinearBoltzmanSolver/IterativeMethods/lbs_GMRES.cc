@@ -4,8 +4,9 @@
 
 #include "ChiTimer/chi_timer.h"
 #include "../Tools/kspmonitor_npt.h"
-#include "../Tools/ksp_data_context.h"
+#include "../Tools/krylov_state.h"
 #include "../IterativeOperations/lbs_matrixaction_Ax.h"
+#include "../IterativeOperations/lbs_preconditioner_dsa.h"
 
 #include "../../DiffusionSolver/Solver/diffusion_solver.h"
 
@@ -46,60 +47,86 @@ void LinearBoltzman::Solver::GMRES(int group_set_num)
   //================================================== Setting up required
   //                                                   sweep chunks
   SweepChunk* sweep_chunk = SetSweepChunk(group_set_num);
-  MainSweepScheduler sweepScheduler(SchedulingAlgorithm::DEPTH_OF_GRAPH,
-                                    groupset->angle_agg);
+  MainSweepScheduler sweepScheduler(
+    static_cast<SchedulingAlgorithm>(options.sweep_scheduler),
+    groupset->angle_agg);
+  sweepScheduler.SetNumberOfThreads(options.sweep_num_threads);
+  if (options.sweep_aggregate_messages)
+    sweepScheduler.SetMessageAggregation(&comm_set);
+  sweepScheduler.SetEventDriven(options.sweep_event_driven);
+  sweepScheduler.SetLogAngleSetEvents(groupset->log_sweep_events);
+
+  //=================================================== Obtain the Krylov
+  //                                                    state
+  //The state is kept with the groupset when reuse is enabled and
+  //recreated when the number of unknowns changed.
+  auto num_ang_unknowns = groupset->angle_agg->GetNumberOfAngularUnknowns();
+  int local_size = local_dof_count*num_moments*groupset_numgrps +
+                   num_ang_unknowns.first;
+  int globl_size = glob_dof_count*num_moments*groupset_numgrps +
+                   num_ang_unknowns.second;
+
+  LBSKrylovState*& krylov_state = groupset->krylov_state;
+  if ((krylov_state != nullptr) and
+      ((krylov_state->local_size != local_size) or
+       (krylov_state->globl_size != globl_size)))
+    groupset->DestroyKrylovState();
 
-  //=================================================== Create Data context
+  bool reusing_krylov_state = (krylov_state != nullptr);
+  if (not reusing_krylov_state)
+  {
+    krylov_state = new LBSKrylovState();
+    krylov_state->Create(local_size,globl_size);
+  }
+  else
+    chi_log.Log(LOG_0) << "Reusing Krylov solver of previous execution.";
+
+  phi_new = krylov_state->phi_new;
+  phi_old = krylov_state->phi_old;
+  q_fixed = krylov_state->q_fixed;
+  KSP ksp = krylov_state->ksp;
+
+  //=================================================== Update Data context
   //                                                    available inside
   //                                                    Action
-  KSPDataContext data_context;
+  KSPDataContext& data_context = krylov_state->data_context;
   data_context.solver         = this;
   data_context.sweep_chunk    = sweep_chunk;
   data_context.group_set_num  = group_set_num;
   data_context.groupset       = groupset;
   data_context.sweepScheduler = &sweepScheduler;
-
-
-  //=================================================== Create the matrix
-  Mat A;
-  auto num_ang_unknowns = groupset->angle_agg->GetNumberOfAngularUnknowns();
-  int local_size = local_dof_count*num_moments*groupset_numgrps +
-                   num_ang_unknowns.first;
-  int globl_size = glob_dof_count*num_moments*groupset_numgrps +
-                   num_ang_unknowns.second;
-  MatCreateShell(PETSC_COMM_WORLD,local_size,
-                                  local_size,
-                                  globl_size,
-                                  globl_size,
-                                  &data_context,&A);
-
-  //================================================== Set the action-operator
-  MatShellSetOperation(A, MATOP_MULT,(void (*)(void)) NPTMatrixAction_Ax);
-
-  //================================================== Initial vector assembly
-  VecCreate(PETSC_COMM_WORLD,&phi_new);
-  VecCreate(PETSC_COMM_WORLD,&phi_old);
-  VecCreate(PETSC_COMM_WORLD,&q_fixed);
-
-  VecSetSizes(phi_new,
-              local_size,     //Local size
-              globl_size);     //Global size
-  VecSetType(phi_new,VECMPI);
-  VecSet(phi_new,0.0);
-  VecDuplicate(phi_new,&phi_old);
-  VecDuplicate(phi_new,&q_fixed);
-  VecDuplicate(phi_new,&data_context.x_temp);
-
-  //================================================== Create Krylov Solver
-  KSP ksp;
-  KSPCreate(PETSC_COMM_WORLD, &ksp);
-  KSPSetType(ksp,KSPGMRES);
-  KSPSetOperators(ksp,A,A);
-  data_context.krylov_solver = ksp;
+  data_context.last_iteration = -1;
+
+  //=================================================== Determine how DSA
+  //                                                    is applied
+  //With FGMRES, or when requested, DSA is applied as right preconditioner
+  //instead of inside the action of the operator.
+  bool use_fgmres = (groupset->iterative_method == NPT_FGMRES);
+  bool apply_dsa  = groupset->apply_wgdsa or groupset->apply_tgdsa;
+  bool dsa_as_pc  = apply_dsa and
+                    (use_fgmres or groupset->dsa_as_preconditioner);
+  data_context.apply_dsa_in_action = not dsa_as_pc;
+  data_context.flexible_dsa        = use_fgmres;
+
+  //================================================== Configure Krylov Solver
+  if (groupset->iterative_method == NPT_LGMRES)
+    KSPSetType(ksp,KSPLGMRES);
+  else
+    KSPSetType(ksp,(use_fgmres)? KSPFGMRES : KSPGMRES);
 
   PC pc;
   KSPGetPC(ksp,&pc);
-  PCSetType(pc,PCNONE);
+  if (dsa_as_pc)
+  {
+    chi_log.Log(LOG_0) << "Applying DSA as right preconditioner.";
+    PCSetType(pc,PCSHELL);
+    PCShellSetContext(pc,&data_context);
+    PCShellSetApply(pc,NPTPreconditioner_DSA);
+    PCShellSetName(pc,"DSA");
+    KSPSetPCSide(ksp,PC_RIGHT);
+  }
+  else
+    PCSetType(pc,PCNONE);
 
   KSPSetTolerances(ksp,1.e-50,
                    groupset->residual_tolerance,1.0e50,
@@ -120,18 +147,18 @@ void LinearBoltzman::Solver::GMRES(int group_set_num)
   sweepScheduler.Sweep(sweep_chunk);
 
   //=================================================== Apply DSA
-  if (groupset->apply_wgdsa)
+  if (groupset->apply_wgdsa and not dsa_as_pc)
   {
     std::vector<double> phi_old_gmres(phi_old_local.size(),0.0);
     AssembleWGDSADeltaPhiVector(groupset, phi_old_gmres.data(), phi_new_local.data());
-    ((chi_diffusion::Solver*)groupset->wgdsa_solver)->ExecuteS(true,false);
+    NPTApplyDSAInverseZeroGuess(groupset->wgdsa_solver);
     DisAssembleWGDSADeltaPhiVector(groupset, phi_new_local.data());
   }
-  if (groupset->apply_tgdsa)
+  if (groupset->apply_tgdsa and not dsa_as_pc)
   {
     std::vector<double> phi_old_gmres(phi_old_local.size(),0.0);
     AssembleTGDSADeltaPhiVector(groupset, phi_old_gmres.data(), phi_new_local.data());
-    ((chi_diffusion::Solver*)groupset->tgdsa_solver)->ExecuteS(true,false);
+    NPTApplyDSAInverseZeroGuess(groupset->tgdsa_solver);
     DisAssembleTGDSADeltaPhiVector(groupset, phi_new_local.data());
   }
 
@@ -146,12 +173,46 @@ void LinearBoltzman::Solver::GMRES(int group_set_num)
   double phi_old_norm=0.0;
   VecNorm(phi_old,NORM_2,&phi_old_norm);
 
-  if (phi_old_norm > 1.0e-10)
+  //The projection onto the stored solutions is only optimal for the
+  //operator with which they were stored. Its actual residual is
+  //compared with that of phi_old, which costs a sweep each. When
+  //phi_old is better the operator or source changed and the stored
+  //solutions are discarded.
+  bool use_projection = false;
+  if (krylov_state->FormInitialGuess(q_fixed,phi_new))
   {
-    VecCopy(phi_old,phi_new);
-    chi_log.Log(LOG_0) << "Using phi_old as initial guess.";
+    double proj_residual = krylov_state->ResidualNorm(q_fixed,phi_new);
+    double old_residual  = 0.0;
+    if (phi_old_norm > 1.0e-10)
+      old_residual = krylov_state->ResidualNorm(q_fixed,phi_old);
+    else
+      VecNorm(q_fixed,NORM_2,&old_residual);
+
+    use_projection = (proj_residual < old_residual);
+    if (use_projection)
+      chi_log.Log(LOG_0)
+        << "Using projection onto " << krylov_state->guess_x.size()
+        << " previous solution(s) as initial guess. Residual "
+        << proj_residual << " vs " << old_residual << " for phi_old.";
+    else
+    {
+      chi_log.Log(LOG_0)
+        << "Discarding stored solutions, their projection has residual "
+        << proj_residual << " vs " << old_residual << " for phi_old.";
+      krylov_state->ClearSolutions();
+    }
   }
 
+  if (not use_projection)
+  {
+    if (phi_old_norm > 1.0e-10)
+    {
+      VecCopy(phi_old,phi_new);
+      chi_log.Log(LOG_0) << "Using phi_old as initial guess.";
+    }
+    else
+      VecSet(phi_new,0.0);
+  }
 
   //**************** CALL GMRES SOLVE ******************
   chi_log.Log(LOG_0)
@@ -166,18 +227,19 @@ void LinearBoltzman::Solver::GMRES(int group_set_num)
       << "GMRES solver failed. "
       << "Reason: " << chi_physics::GetPETScConvergedReasonstring(reason);
 
+  //==================================================== Recycle solution
+  if (groupset->krylov_reuse)
+    krylov_state->AddSolution(phi_new,groupset->krylov_num_guess_vectors);
 
   DisAssembleVector(groupset, phi_new, phi_new_local.data());
   DisAssembleVector(groupset, phi_new, phi_old_local.data());
 
   //==================================================== Clean up
-  KSPDestroy(&ksp);
-  VecDestroy(&phi_new);
-  VecDestroy(&phi_old);
-  VecDestroy(&q_fixed);
-  VecDestroy(&data_context.x_temp);
-  MatDestroy(&A);
-
+  if (not groupset->krylov_reuse)
+    groupset->DestroyKrylovState();
+  phi_new = nullptr;
+  phi_old = nullptr;
+  q_fixed = nullptr;
 
 
   double sweep_time = sweepScheduler.GetAverageSweepTime();
@@ -46,8 +46,14 @@ void LinearBoltzman::Solver::ClassicRichardson(int group_set_num)
   SweepChunk* sweep_chunk = SetSweepChunk(group_set_num);
 
   //================================================== Set sweep scheduler
-  MainSweepScheduler sweepScheduler(SchedulingAlgorithm::DEPTH_OF_GRAPH,
-                                    groupset->angle_agg);
+  MainSweepScheduler sweepScheduler(
+    static_cast<SchedulingAlgorithm>(options.sweep_scheduler),
+    groupset->angle_agg);
+  sweepScheduler.SetNumberOfThreads(options.sweep_num_threads);
+  if (options.sweep_aggregate_messages)
+    sweepScheduler.SetMessageAggregation(&comm_set);
+  sweepScheduler.SetEventDriven(options.sweep_event_driven);
+  sweepScheduler.SetLogAngleSetEvents(groupset->log_sweep_events);
 
   //================================================== Tool the sweep chunk
   sweep_chunk->SetDestinationPhi(&phi_new_local);
@@ -69,13 +75,13 @@ void LinearBoltzman::Solver::ClassicRichardson(int group_set_num)
     if (groupset->apply_wgdsa)
     {
       AssembleWGDSADeltaPhiVector(groupset, phi_old_local.data(), phi_new_local.data());
-      ((chi_diffusion::Solver*)groupset->wgdsa_solver)->ExecuteS(true,false);
+      ((chi_diffusion::Solver*)groupset->wgdsa_solver)->ApplyOperatorInverse();
       DisAssembleWGDSADeltaPhiVector(groupset, phi_new_local.data());
     }
     if (groupset->apply_tgdsa)
     {
       AssembleTGDSADeltaPhiVector(groupset, phi_old_local.data(), phi_new_local.data());
-      ((chi_diffusion::Solver*)groupset->tgdsa_solver)->ExecuteS(true,false);
+      ((chi_diffusion::Solver*)groupset->tgdsa_solver)->ApplyOperatorInverse();
       DisAssembleTGDSADeltaPhiVector(groupset, phi_new_local.data());
     }
 
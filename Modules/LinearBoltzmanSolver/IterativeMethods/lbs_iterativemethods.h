@@ -7,5 +7,9 @@
 #define NPT_CLASSICRICHARDSON_CYCLES 2
 #define NPT_GMRES                    3
 #define NPT_GMRES_CYCLES             4
+#define NPT_FGMRES                   5
+#define NPT_FGMRES_CYCLES            6
+#define NPT_LGMRES                   7
+#define NPT_LGMRES_CYCLES            8
 
 #endif
\ No newline at end of file
@@ -5,6 +5,26 @@
 #include "../../DiffusionSolver/Solver/diffusion_solver.h"
 
 typedef chi_mesh::sweep_management::SweepScheduler MainSweepScheduler;
+
+//###################################################################
+/**Applies the inverse of a DSA operator starting from a zero initial
+ * guess. Since the DSA solve is only converged to the DSA tolerance,
+ * reusing the previous solution would make the result depend on the
+ * order of earlier applications, whereas the Krylov methods require
+ * a fixed linear operator. The initial guess option of the diffusion
+ * solver is restored afterwards.*/
+void NPTApplyDSAInverseZeroGuess(chi_physics::Solver* dsa_solver)
+{
+  auto dsolver = (chi_diffusion::Solver*)dsa_solver;
+
+  bool saved_reuse_initial_guess = dsolver->reuse_initial_guess;
+  dsolver->reuse_initial_guess = false;
+
+  dsolver->ApplyOperatorInverse();
+
+  dsolver->reuse_initial_guess = saved_reuse_initial_guess;
+}
+
 //###################################################################
 /**Computes the action of the transport matrix on a vector.*/
 int NPTMatrixAction_Ax(Mat matrix, Vec krylov_vector, Vec Ax)
@@ -34,21 +54,21 @@ int NPTMatrixAction_Ax(Mat matrix, Vec krylov_vector, Vec Ax)
   sweepScheduler->Sweep(sweep_chunk);
 
   //=================================================== Apply WGDSA
-  if (groupset->apply_wgdsa)
+  if (groupset->apply_wgdsa and context->apply_dsa_in_action)
   {
     solver->AssembleWGDSADeltaPhiVector(groupset,
                                         solver->phi_old_local.data(),
                                         solver->phi_new_local.data());
-    ((chi_diffusion::Solver*)groupset->wgdsa_solver)->ExecuteS(true,false);
+    NPTApplyDSAInverseZeroGuess(groupset->wgdsa_solver);
     solver->DisAssembleWGDSADeltaPhiVector(groupset,
                                            solver->phi_new_local.data());
   }
-  if (groupset->apply_tgdsa)
+  if (groupset->apply_tgdsa and context->apply_dsa_in_action)
   {
     solver->AssembleTGDSADeltaPhiVector(groupset,
                                         solver->phi_old_local.data(),
                                         solver->phi_new_local.data());
-    ((chi_diffusion::Solver*)groupset->tgdsa_solver)->ExecuteS(true,false);
+    NPTApplyDSAInverseZeroGuess(groupset->tgdsa_solver);
     solver->DisAssembleTGDSADeltaPhiVector(groupset,
                                            solver->phi_new_local.data());
   }
@@ -4,3 +4,4 @@
 
 
 int NPTMatrixAction_Ax(Mat matrix, Vec krylov_vector, Vec Ax);
+void NPTApplyDSAInverseZeroGuess(chi_physics::Solver* dsa_solver);
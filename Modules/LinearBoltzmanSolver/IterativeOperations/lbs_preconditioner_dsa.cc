@@ -0,0 +1,103 @@
+#include "lbs_preconditioner_dsa.h"
+#include "../Tools/ksp_data_context.h"
+
+#include "../../DiffusionSolver/Solver/diffusion_solver.h"
+
+#include <algorithm>
+
+//###################################################################
+/**Applies the inverse of a DSA operator as part of the preconditioner.
+ *
+ * The solve starts from a zero initial guess, such that the
+ * preconditioner does not depend on previous applications, as required
+ * by plain GMRES. With a flexible outer method the inner solve is
+ * relaxed as the outer residual decreases, the inner tolerance then
+ * follows the ratio of the outer tolerance to the current outer
+ * relative residual, but is never tighter than the groupset's DSA
+ * tolerance nor looser than 0.1. The tolerances and the initial guess
+ * option of the diffusion solver are restored afterwards.*/
+static void ApplyDSAPreconditionerSolve(KSPDataContext* context,
+                                        chi_diffusion::Solver* dsolver,
+                                        double dsa_tol)
+{
+  double tol = dsa_tol;
+  if (context->flexible_dsa)
+  {
+    LBSGroupset* groupset = context->groupset;
+    double outer_residual =
+      std::max(groupset->latest_convergence_metric,1.0e-50);
+    double relaxed_tol =
+      std::min(0.1,groupset->residual_tolerance/outer_residual);
+    tol = std::max(dsa_tol,relaxed_tol);
+  }
+
+  //=================================== Save settings
+  PetscReal saved_rtol, saved_abstol, saved_dtol;
+  PetscInt  saved_maxits;
+  KSPGetTolerances(dsolver->ksp,&saved_rtol,&saved_abstol,
+                                &saved_dtol,&saved_maxits);
+  bool saved_reuse_initial_guess = dsolver->reuse_initial_guess;
+
+  //=================================== Solve
+  KSPSetTolerances(dsolver->ksp,1.e-50,tol,1.0e50,dsolver->max_iters);
+  dsolver->reuse_initial_guess = false;
+
+  dsolver->ApplyOperatorInverse();
+
+  //=================================== Restore settings
+  KSPSetTolerances(dsolver->ksp,saved_rtol,saved_abstol,
+                                saved_dtol,saved_maxits);
+  dsolver->reuse_initial_guess = saved_reuse_initial_guess;
+}
+
+//###################################################################
+/**Applies the diffusion synthetic acceleration as a preconditioner,
+ * i.e. Pv = v + D^{-1} S v, where S is the scattering operator of the
+ * groupset and D the (within-group and/or two-grid) diffusion operator.
+ * The angular unknowns of the vector pass through unchanged.*/
+int NPTPreconditioner_DSA(PC pc, Vec krylov_vector, Vec Pv)
+{
+  KSPDataContext* context;
+  PCShellGetContext(pc,&context);
+
+  LinearBoltzman::Solver* solver = context->solver;
+  LBSGroupset* groupset  = context->groupset;
+
+  //============================================= Copy krylov vector into local
+  solver->DisAssembleVector(groupset,
+                            krylov_vector,
+                            solver->phi_new_local.data());
+
+  //The correction acts on the vector itself, not on a change
+  context->dsa_phi_zero.assign(solver->phi_old_local.size(),0.0);
+
+  //=================================================== Apply WGDSA
+  if (groupset->apply_wgdsa)
+  {
+    auto wgdsa_solver = (chi_diffusion::Solver*)groupset->wgdsa_solver;
+
+    solver->AssembleWGDSADeltaPhiVector(groupset,
+                                        context->dsa_phi_zero.data(),
+                                        solver->phi_new_local.data());
+    ApplyDSAPreconditionerSolve(context,wgdsa_solver,groupset->wgdsa_tol);
+    solver->DisAssembleWGDSADeltaPhiVector(groupset,
+                                           solver->phi_new_local.data());
+  }
+  if (groupset->apply_tgdsa)
+  {
+    auto tgdsa_solver = (chi_diffusion::Solver*)groupset->tgdsa_solver;
+
+    solver->AssembleTGDSADeltaPhiVector(groupset,
+                                        context->dsa_phi_zero.data(),
+                                        solver->phi_new_local.data());
+    ApplyDSAPreconditionerSolve(context,tgdsa_solver,groupset->tgdsa_tol);
+    solver->DisAssembleTGDSADeltaPhiVector(groupset,
+                                           solver->phi_new_local.data());
+  }
+
+  solver->AssembleVector(groupset,
+                         Pv,
+                         solver->phi_new_local.data());
+
+  return 0;
+}
@@ -0,0 +1,6 @@
+#include <LinearBoltzmanSolver/lbs_linear_boltzman_solver.h>
+#include <petscksp.h>
+
+
+
+int NPTPreconditioner_DSA(PC pc, Vec krylov_vector, Vec Pv);
@@ -33,7 +33,9 @@ SweepChunk* LinearBoltzman::Solver::SetSweepChunk(int group_set_num)
         &q_moments_local,                        //Source moments
         groupset,                                //Reference groupset
         &material_xs,                            //Material cross-sections
-        num_moments,max_cell_dof_count);
+        num_moments,max_cell_dof_count,
+        &sweep_data_packs,                       //Sweep ordered cell data
+        options.sweep_level_threads);            //Threads per level
 
   return sweep_chunk;
 }
\ No newline at end of file
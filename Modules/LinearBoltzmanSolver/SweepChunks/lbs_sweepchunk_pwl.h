@@ -19,6 +19,12 @@
 #include "ChiMesh/SweepUtilities/AngleAggregation/angleaggregation.h"
 
 #include "ChiTimer/chi_timer.h"
+#include "ChiMesh/SweepUtilities/SweepScheduler/sweep_threadpool.h"
+#include "lbs_sweepdatapack.h"
+
+#include <algorithm>
+#include <memory>
+#include <map>
 
 #include <chi_mpi.h>
 #include <chi_log.h>
@@ -44,20 +50,46 @@ private:
   int                         num_moms;
 
   int                         G;
-  int                         g;
-  chi_mesh::Vector            omega;
-  double                      wn;
 
   int                         max_cell_dofs;
 
+  typedef LinearBoltzman::SweepDataPack SweepDataPack;
+  typedef std::map<chi_mesh::sweep_management::SPDS*,SweepDataPack*> PackMap;
+  const PackMap*              sweep_data_packs;
+  const SweepDataPack*        pack;   ///< Pack of the current angle set
+
   bool                        a_and_b_initialized;
 
 //bool                        suppress_surface_src; BASE CLASS
 
-  std::vector<std::vector<double>> Amat;
-  std::vector<std::vector<double>> Atemp;
-  std::vector<std::vector<double>> b;
-  std::vector<double>              source;
+  /**Scratch space of a cell solve. One per thread.*/
+  struct CellScratch
+  {
+    std::vector<double>       Amat;   ///< Row-major [max_cell_dofs^2]
+    std::vector<double>       Atemp;  ///< Group-batched [max_cell_dofs^2][G]
+    std::vector<double>       batch_scratch;
+    std::vector<double>       psi_upwind; ///< Promoted upwind psi [G]
+
+    //Cell blocks of width K = cell_dofs*G, row-major
+    std::vector<double>       q_cell;   ///< Source moments [num_moms][K]
+    std::vector<double>       phi_cell; ///< Flux moments [num_moms][K]
+    std::vector<double>       src_all;  ///< Angular source [num_angles][K]
+    std::vector<double>       psi_all;  ///< Angular flux [num_angles][K]
+  };
+  std::vector<CellScratch>    scratch;
+
+  //Threads sweeping the cells of a level concurrently
+  int                         num_level_threads;
+  std::shared_ptr<chi_mesh::sweep_management::SweepThreadPool> level_pool;
+
+  //Angle set quantities constant over all cells in a sweep
+  std::vector<double>         m2d_as; ///< Row-major [num_angles][num_moms]
+  std::vector<double>         d2m_as; ///< Row-major [num_moms][num_angles]
+  int                         gs_ss_size;
+  int                         gs_ss_begin;
+  int                         gs_gi;
+  double*                     phi;
+  double*                     q_mom;
 
   int LOCAL;
   double test_source;
@@ -78,7 +110,9 @@ public:
                    LBSGroupset* in_groupset,
                    TCrossSections* in_xsections,
                    int in_num_moms,
-                   int in_max_cell_dofs)
+                   int in_max_cell_dofs,
+                   const PackMap* in_sweep_data_packs,
+                   int in_num_level_threads=1)
   {
     grid_view           = vol_continuum;
     grid_fe_view        = discretization;
@@ -89,6 +123,9 @@ public:
     xsections           = in_xsections;
     num_moms            = in_num_moms;
     max_cell_dofs       = in_max_cell_dofs;
+    sweep_data_packs    = in_sweep_data_packs;
+    pack                = nullptr;
+    num_level_threads   = std::max(1,in_num_level_threads);
 
 
     G                   = in_groupset->groups.size();
@@ -102,319 +139,420 @@ public:
     test_mg_src.resize(G,test_source);
     test_mg_src[0] = test_source;
     zero_mg_src.resize(G,0.0);
+
+    if (num_level_threads > 1)
+      level_pool = std::make_shared<chi_mesh::sweep_management::
+                                    SweepThreadPool>(num_level_threads-1);
   }
 
 
   //############################################################ Actual chunk
   void Sweep(chi_mesh::sweep_management::AngleSet* angle_set)
   {
-    int outface_master_counter=0;
-
     if (!a_and_b_initialized)
     {
-      Amat.resize(max_cell_dofs,std::vector<double>(max_cell_dofs));
-      Atemp.resize(max_cell_dofs,std::vector<double>(max_cell_dofs));
-      b.resize(G,std::vector<double>(max_cell_dofs,0.0));
-      source.resize(max_cell_dofs,0.0);
+      scratch.resize(num_level_threads);
+      for (auto& sc : scratch)
+      {
+        sc.Amat.resize(max_cell_dofs*max_cell_dofs,0.0);
+        sc.Atemp.resize(max_cell_dofs*max_cell_dofs*G,0.0);
+        sc.batch_scratch.resize(G,0.0);
+        sc.psi_upwind.resize(G,0.0);
+        sc.q_cell.resize(num_moms*max_cell_dofs*G,0.0);
+        sc.phi_cell.resize(num_moms*max_cell_dofs*G,0.0);
+      }
 
       a_and_b_initialized = true;
     }
 
+    //========================================================== Angle set operators
+    // The moment-to-discrete and discrete-to-moment operators restricted
+    // to the angles of this angle set, stored densely so that they can be
+    // applied to all the dofs and groups of a cell as one product.
+    const int num_as_angles = angle_set->angles.size();
+    m2d_as.resize(num_as_angles*num_moms);
+    d2m_as.resize(num_moms*num_as_angles);
+    for (int n=0; n<num_as_angles; n++)
+    {
+      int angle_num = angle_set->angles[n];
+      for (int m=0; m<num_moms; m++)
+      {
+        m2d_as[n*num_moms+m]      = groupset->m2d_op[m][angle_num];
+        d2m_as[m*num_as_angles+n] = groupset->d2m_op[m][angle_num];
+      }
+    }
+
+    for (auto& sc : scratch)
+      if (sc.psi_all.size() < num_as_angles*max_cell_dofs*G)
+      {
+        sc.src_all.resize(num_as_angles*max_cell_dofs*G,0.0);
+        sc.psi_all.resize(num_as_angles*max_cell_dofs*G,0.0);
+      }
+
     chi_mesh::sweep_management::SPDS* spds = angle_set->GetSPDS();
-    chi_mesh::sweep_management::FLUDS* fluds = angle_set->fluds;
+    pack = sweep_data_packs->at(spds);
 
     GsSubSet& subset = groupset->grp_subsets[angle_set->ref_subset];
-    int gs_ss_size  = groupset->grp_subset_sizes[angle_set->ref_subset];
-
-    int gs_ss_begin = subset.first;
-    int gs_ss_end   = subset.second;
+    gs_ss_size  = groupset->grp_subset_sizes[angle_set->ref_subset];
+    gs_ss_begin = subset.first;
 
     //Groupset subset first group number
-    int gs_gi = groupset->groups[gs_ss_begin]->id;
+    gs_gi = groupset->groups[gs_ss_begin]->id;
 
+    phi   = x->data();
+    q_mom = q_moments->data();
 
-    int deploc_face_counter = -1;
-    int preloc_face_counter = -1;
-    int bndry_face_counter  = -1;
-
-    double* phi        = x->data();
-    double* psi        = zero_mg_src.data();
-    double* q_mom      = q_moments->data();
+    //========================================================== Loop over levels
+    // Cells within a level do not depend on one another and are
+    // distributed over the level threads. The calling thread uses the
+    // last scratch space.
+    const auto& spls = *spds->spls;
+    if (level_pool and not spls.level_start.empty())
+    {
+      size_t num_levels = spls.level_start.size()-1;
+      for (size_t l=0; l<num_levels; l++)
+      {
+        int level_begin = spls.level_start[l];
+        int level_size  = spls.level_start[l+1] - level_begin;
 
+        if (level_size < 2)
+        {
+          for (int cr_i=level_begin; cr_i<level_begin+level_size; cr_i++)
+            SweepCellDispatch(angle_set,cr_i,scratch.back());
+          continue;
+        }
 
+        level_pool->ParallelFor(level_size,
+          [this,angle_set,level_begin](int thread_id, int begin, int end)
+          {
+            for (int cr_i=level_begin+begin; cr_i<level_begin+end; cr_i++)
+              SweepCellDispatch(angle_set,cr_i,scratch[thread_id]);
+          });
+      }//for level
+    }
     //========================================================== Loop over each cell
-    size_t num_loc_cells = spds->spls->item_id.size();
-    for (int cr_i=0; cr_i<num_loc_cells; cr_i++)
+    else
     {
-      int    cell_g_index = spds->spls->item_id[cr_i];
-      auto   cell         = grid_view->cells[cell_g_index];
+      size_t num_loc_cells = spls.item_id.size();
+      for (int cr_i=0; cr_i<num_loc_cells; cr_i++)
+        SweepCellDispatch(angle_set,cr_i,scratch.back());
+    }
 
-      auto cell_fe_view   = (CellFEView*)grid_fe_view->MapFeView(cell_g_index);
-      auto transport_view =
-        (LinearBoltzman::CellViewFull*)(*grid_transport_view)[cell->cell_local_id];
+  }//Sweep function
 
-      int     cell_dofs    = cell_fe_view->dofs;
-      int     xs_id        = transport_view->xs_id;
-      double* sigma_tg = (*xsections)[xs_id]->sigma_tg.data();
+  //############################################################ Worker copy
+  /**Copies the chunk. The copy owns its scratch matrices and can sweep
+   * concurrently with this chunk.*/
+  chi_mesh::sweep_management::SweepChunk* CreateWorkerCopy() override
+  {
+    auto worker_copy = new LBSSweepChunkPWL(*this);
 
+    //Worker copies already execute concurrently and sweep levels serially
+    worker_copy->num_level_threads   = 1;
+    worker_copy->level_pool          = nullptr;
+    worker_copy->a_and_b_initialized = false;
+    worker_copy->scratch.clear();
 
-      //=================================================== Get Cell matrices
-      const std::vector<std::vector<chi_mesh::Vector>>& L =
-        cell_fe_view->IntV_shapeI_gradshapeJ;
+    return worker_copy;
+  }
 
-      const std::vector<std::vector<double>>& M =
-        cell_fe_view->IntV_shapeI_shapeJ;
+private:
+  //############################################################ Cell dispatch
+  /**Sweeps the cell with sweep order index cr_i with the kernel
+   * specialized for its number of dofs.*/
+  void SweepCellDispatch(chi_mesh::sweep_management::AngleSet* angle_set,
+                         int cr_i, CellScratch& sc)
+  {
+    const SweepDataPack::CellData& cd = pack->cells[cr_i];
 
-      const std::vector<std::vector<std::vector<double>>>& N =
-        cell_fe_view->IntS_shapeI_shapeJ;
+    switch (cd.num_dofs)
+    {
+      case 2: SweepCell<2>(angle_set,cr_i,cd,sc); break;
+      case 3: SweepCell<3>(angle_set,cr_i,cd,sc); break;
+      case 4: SweepCell<4>(angle_set,cr_i,cd,sc); break;
+      case 6: SweepCell<6>(angle_set,cr_i,cd,sc); break;
+      case 8: SweepCell<8>(angle_set,cr_i,cd,sc); break;
+      default:
+        SweepCell<0>(angle_set,cr_i,cd,sc);
+    }
+  }
 
-      //=================================================== Loop over angles in set
-      int ni_deploc_face_counter = deploc_face_counter;
-      int ni_preloc_face_counter = preloc_face_counter;
-      int ni_bndry_face_counter  = bndry_face_counter;
-      for (int n=0; n<angle_set->angles.size(); n++)
+  //############################################################ Cell kernel
+  /**Sweeps all the angles of an angle set on a single cell. NDOFS is the
+   * number of cell dofs known at compile time, which allows the angular
+   * cell matrix to live on the stack and the solve to be unrolled. NDOFS=0
+   * is the general kernel for any cell and uses the scratch matrices
+   * sized with max_cell_dofs.
+   *
+   * The groups of the groupset subset only differ by the sigma_tg*M term
+   * and are therefore solved together, interleaved as SIMD lanes, with
+   * chi_math::batched::GaussElimination.
+   *
+   * The source moments of the cell are gathered once and mapped to the
+   * angular source of all the angles of the set with a single product.
+   * The angular fluxes of all angles are kept and reduced into flux
+   * moments with a single product after the angle loop.
+   *
+   * All cell data is read from the sweep data pack of the SPDS, which
+   * stores it contiguously in sweep order.*/
+  template<int NDOFS>
+  void SweepCell(chi_mesh::sweep_management::AngleSet* angle_set,
+                 int cr_i,
+                 const SweepDataPack::CellData& cd,
+                 CellScratch& sc)
+  {
+    typedef chi_mesh::sweep_management::SweepPlan SweepPlan;
+    chi_mesh::sweep_management::FLUDS* fluds = angle_set->fluds;
+    const SweepPlan& plan = fluds->GetSweepPlan();
+
+    const int     cell_dofs = (NDOFS > 0)? NDOFS : cd.num_dofs;
+    const double* sigma_tg  = cd.sigma_tg;
+
+    //Only needed for the boundary ids of boundary faces
+    auto transport_view =
+      (LinearBoltzman::CellViewFull*)(*grid_transport_view)[cd.cell_local_id];
+
+    const int nb        = gs_ss_size;
+    const int K         = cell_dofs*nb;
+    const int num_as_angles = angle_set->angles.size();
+
+    double  Amat_s[(NDOFS > 0)? NDOFS*NDOFS : 1];
+    double* A_n   = (NDOFS > 0)? Amat_s  : sc.Amat.data();
+    double* A_g   = sc.Atemp.data();
+    double* psi   = zero_mg_src.data();
+    double* psi_upwind = sc.psi_upwind.data();
+
+    //Interface psi stored in single precision (see AngleSet)
+    const bool single_precision = angle_set->single_precision_psi;
+
+    //=================================================== Get Cell matrices
+    const double* L = pack->L(cd);
+    const double* M = pack->M(cd);
+
+    //=================================================== Get cell sweep plan
+    const SweepPlan::Face* inco_begin =
+      plan.inco_faces.data() + plan.cell_inco_face_start[cr_i];
+    const SweepPlan::Face* inco_end   =
+      plan.inco_faces.data() + plan.cell_inco_face_start[cr_i+1];
+    const SweepPlan::Face* outb_begin =
+      plan.outb_faces.data() + plan.cell_outb_face_start[cr_i];
+    const SweepPlan::Face* outb_end   =
+      plan.outb_faces.data() + plan.cell_outb_face_start[cr_i+1];
+
+    //=================================================== Angular source
+    double* q_cell = sc.q_cell.data();
+    for (int m=0; m<num_moms; m++)
+      for (int i=0; i<cell_dofs; i++)
       {
-        deploc_face_counter = ni_deploc_face_counter;
-        preloc_face_counter = ni_preloc_face_counter;
-        bndry_face_counter  = ni_bndry_face_counter;
+        const double* q_img = &q_mom[pack->MapDOF(cd,i,m,gs_gi)];
+        std::copy(q_img,q_img+nb,&q_cell[m*K+i*nb]);
+      }
+
+    std::fill(sc.src_all.begin(),sc.src_all.begin()+num_as_angles*K,0.0);
+    chi_math::MatMulAdd(num_as_angles,K,num_moms,
+                        m2d_as.data(),num_moms,
+                        q_cell,K,
+                        sc.src_all.data(),K);
+
+    //=================================================== Loop over angles in set
+    for (int n=0; n<num_as_angles; n++)
+    {
+      const int              angle_num = angle_set->angles[n];
+      const chi_mesh::Vector omega     = *groupset->quadrature->omegas[angle_num];
 
-        angle_num = angle_set->angles[n];
-        omega = *groupset->quadrature->omegas[angle_num];
-        wn    = groupset->quadrature->weights[angle_num];
+      const double* src = &sc.src_all[n*K];
+      double*       b   = &sc.psi_all[n*K];
 
-        //============================================ Gradient matrix
-        for (int i=0; i<cell_dofs; i++)
+      //============================================ Gradient matrix
+      for (int i=0; i<cell_dofs; i++)
+      {
+        for (int j=0; j<cell_dofs; j++)
         {
-          for (int j=0; j<cell_dofs; j++)
-          {
-            Amat[i][j] = omega.Dot(L[i][j]);
-          }//for j
-        }//for i
+          const double* Lij = &L[3*(i*cell_dofs+j)];
+          A_n[i*cell_dofs+j] = omega.x*Lij[0] + omega.y*Lij[1] + omega.z*Lij[2];
+        }//for j
+      }//for i
 
-        for (int gsg=0; gsg<gs_ss_size; gsg++)
-          b[gsg].assign(cell_dofs,0.0);
+      std::fill(b,b+cell_dofs*nb,0.0);
 
 
-        //============================================ Surface integrals
-        int num_faces = cell->faces.size();
-        int in_face_counter=-1;
-        int internal_face_bndry_counter = -1;
-        for (int f=0; f<num_faces; f++)
+      //============================================ Surface integrals
+      for (auto face = inco_begin; face != inco_end; ++face)
+      {
+        const int  f       = face->f;
+        const int* dof_map = &plan.face_dof_map[face->dof_map_start];
+        const double* n_f  = pack->Normal(cd,f);
+        const double* N_f  = pack->N(cd,f);
+        double     mu      = omega.x*n_f[0] + omega.y*n_f[1] + omega.z*n_f[2];
+
+        //============================== Loop over face unknowns
+        for (int fj=0; fj<face->num_dofs; fj++)
         {
+          int j = dof_map[fj];
 
-          double mu       = omega.Dot(cell->faces[f].normal);
-          int    face_neighbor = transport_view->face_f_adj_part_id[f];
-
-          //============================= Set flags
-          if (mu>=0.0)
-            transport_view->face_f_upwind_flag[f] = false;
-          else
-            transport_view->face_f_upwind_flag[f] = true;
-
-          //This counter update-logic is for mapping an incident boundary
-          //condition. Because it is cheap, the cell faces was mapped to a
-          //corresponding boundary during initialization and is
-          //independent of angle. Accessing things like reflective boundary
-          //angular fluxes (and complex boundary conditions), requires the
-          //more general bndry_face_counter.
-          int bndry_map = -1;
-          if (face_neighbor<0)
+          // %%%%% LOCAL CELL DEPENDENCY %%%%%
+          const float* psi_f = nullptr;
+          if (face->kind == SweepPlan::FACE_LOCAL)
           {
-            internal_face_bndry_counter++;
-            bndry_map = transport_view->
-              face_boundary_id[internal_face_bndry_counter];
+            if (single_precision)
+              psi_f = fluds->UpwindPsiF(cr_i,face->index,fj,0,n);
+            if (not psi_f)
+              psi = fluds->UpwindPsi(cr_i,face->index,fj,0,n);
           }
-
-          if (mu < 0.0) //UPWIND
+            // %%%%% NON-LOCAL CELL DEPENDENCY %%%%%
+          else if (face->kind == SweepPlan::FACE_NONLOCAL)
           {
-            //============================== Increment face counters
-
-            if (face_neighbor == LOCAL)
-            {in_face_counter++;}
-
-            if ((face_neighbor != LOCAL) && (face_neighbor>=0))
-            {preloc_face_counter++;}
-
-            if (face_neighbor<0)
-            {bndry_face_counter++;}
-
-
-            //============================== Loop over face vertices
-            int num_face_indices = cell->faces[f].vertex_ids.size();
-            for (int fi=0; fi<num_face_indices; fi++)
-            {
-              int i = cell_fe_view->face_dof_mappings[f][fi];
-
-              //=========== Loop over face unknowns
-              for (int fj=0; fj<num_face_indices; fj++)
-              {
-                int j = cell_fe_view->face_dof_mappings[f][fj];
-
-                // %%%%% LOCAL CELL DEPENDENCY %%%%%
-                if (face_neighbor == LOCAL)
-                {psi = fluds->UpwindPsi(cr_i,in_face_counter,fj,0,n);}
-                  // %%%%% NON-LOCAL CELL DEPENDENCY %%%%%
-                else if (face_neighbor >= 0)
-                {psi = fluds->NLUpwindPsi(preloc_face_counter,fj,0,n);}
-                  // %%%%% BOUNDARY CELL DEPENDENCY %%%%%
-                else
-                {psi = angle_set->PsiBndry(bndry_map,
-                                           angle_num,
-                                           cell->cell_local_id,
-                                           f,fj,gs_gi,gs_ss_begin,
-                                           suppress_surface_src);
-                }
-
-
-                double mu_Nij = -mu*N[f][i][j];
-
-                Amat[i][j] += mu_Nij;
-
-                for (int gsg=0; gsg<gs_ss_size; gsg++)
-                  b[gsg][i] += psi[gsg]*mu_Nij;
-              }
-            };
-
-          }//if mu<0.0
-
-        }//for f
-
-        //========================================== Looping over groups
-        double sigma_tgr = 0.0;
-        double temp_src = 0.0;
-        int gi_deploc_face_counter = deploc_face_counter;
-        int gi_preloc_face_counter = preloc_face_counter;
-        for (int gsg=0; gsg<gs_ss_size; gsg++)
-        {
-          deploc_face_counter = gi_deploc_face_counter;
-          preloc_face_counter = gi_preloc_face_counter;
-
-          g = gs_gi+gsg;
+            if (single_precision)
+              psi_f = fluds->NLUpwindPsiF(face->index,fj,0,n);
+            if (not psi_f)
+              psi = fluds->NLUpwindPsi(face->index,fj,0,n);
+          }
+            // %%%%% BOUNDARY CELL DEPENDENCY %%%%%
+          else
+          {psi = angle_set->PsiBndry(
+                   transport_view->face_boundary_id[face->index],
+                   angle_num,
+                   cd.cell_local_id,
+                   f,fj,gs_gi,gs_ss_begin,
+                   suppress_surface_src);
+          }
 
-          //============================= Contribute source moments
-          double m2d = 0.0;
-          for (int i=0; i<cell_fe_view->dofs; i++)
+          //Single precision upwind psi is promoted before use
+          if (psi_f)
           {
-            temp_src = 0.0;
-            for (int m=0; m<num_moms; m++)
-            {
-              m2d = groupset->m2d_op[m][angle_num];
-              int ir = transport_view->MapDOF(i,m,g);
-              temp_src += m2d*q_mom[ir];
-            }
-            source[i] = temp_src;
+            for (int gsg=0; gsg<nb; gsg++)
+              psi_upwind[gsg] = psi_f[gsg];
+            psi = psi_upwind;
           }
 
-          //============================= Mass Matrix and Source
-          sigma_tgr = sigma_tg[g];
-          for (int i=0; i<cell_fe_view->dofs; i++)
+          //=========== Loop over face vertices
+          for (int fi=0; fi<face->num_dofs; fi++)
           {
-            double temp = 0.0;
-            for (int j=0; j<cell_fe_view->dofs; j++)
-            {
-              double Mij = M[i][j];
-              Atemp[i][j] = Amat[i][j] + Mij*sigma_tgr;
-              temp += Mij*source[j];
-            }//for j
-            b[gsg][i] += temp;
-          }//for i
-
+            int i = dof_map[fi];
 
-          //============================= Solve system
-          chi_math::GaussElimination(Atemp,b[gsg],cell_fe_view->dofs);
+            double mu_Nij = -mu*N_f[i*cell_dofs+j];
 
+            A_n[i*cell_dofs+j] += mu_Nij;
 
-        }//for g
+            for (int gsg=0; gsg<nb; gsg++)
+              b[i*nb+gsg] += psi[gsg]*mu_Nij;
+          }
+        }
+      }//for incoming f
 
+      //========================================== Mass Matrix and Source
+      const double* sigma_tgs = &sigma_tg[gs_gi];
+      for (int i=0; i<cell_dofs; i++)
+      {
+        double* b_i = &b[i*nb];
+        for (int j=0; j<cell_dofs; j++)
+        {
+          double  Mij   = M[i*cell_dofs+j];
+          double  Anij  = A_n[i*cell_dofs+j];
+          double* A_gij = &A_g[(i*cell_dofs+j)*nb];
+          const double* src_j = &src[j*nb];
+          for (int gsg=0; gsg<nb; gsg++)
+          {
+            A_gij[gsg] = Anij + Mij*sigma_tgs[gsg];
+            b_i[gsg]  += Mij*src_j[gsg];
+          }
+        }//for j
+      }//for i
 
+      //========================================== Solve all groups
+      chi_math::batched::GaussElimination<NDOFS>(A_g,b,
+                                                 sc.batch_scratch.data(),
+                                                 nb,cell_dofs);
 
+      //============================================= Outgoing fluxes
+      for (auto face = outb_begin; face != outb_end; ++face)
+      {
+        const int  f       = face->f;
+        const int* dof_map = &plan.face_dof_map[face->dof_map_start];
 
-        //============================= Accumulate flux
-        double wn_d2m = 0.0;
-        for (int m=0; m<num_moms; m++)
+        //============================= Store outgoing Psi Locally
+        if (face->kind == SweepPlan::FACE_LOCAL)
         {
-          wn_d2m = groupset->d2m_op[m][angle_num];
-          for (int i=0; i<cell_fe_view->dofs; i++)
+          for (int fi=0; fi<face->num_dofs; fi++)
           {
-            int ir = transport_view->MapDOF(i,m,gs_gi);
-            for (int gsg=0; gsg<gs_ss_size; gsg++)
+            int i = dof_map[fi];
+            float* psi_f = (single_precision)?
+              fluds->OutgoingPsiF(cr_i,face->index,fi,n) : nullptr;
+
+            if (psi_f)
             {
-              phi[ir+gsg] += wn_d2m*b[gsg][i];
+              for (int gsg=0; gsg<nb; gsg++)
+                psi_f[gsg] = static_cast<float>(b[i*nb+gsg]);
+              continue;
             }
-          }
-        }
 
-        //============================================= Outgoing fluxes
-        int out_face_counter=-1;
-        internal_face_bndry_counter = -1;
-        for (int f=0; f<cell->faces.size(); f++)
-        {
-          int     face_neighbor = transport_view->face_f_adj_part_id[f];
-          bool    face_incident = transport_view->face_f_upwind_flag[f];
-          double* psi = zero_mg_src.data();
+            psi = fluds->OutgoingPsi(cr_i,face->index,fi,n);
 
-          int bndry_map = -1;
-          if (face_neighbor<0)
-          {
-            internal_face_bndry_counter++;
-            bndry_map = transport_view->
-              face_boundary_id[internal_face_bndry_counter];
+            for (int gsg=0; gsg<nb; gsg++)
+              psi[gsg] = b[i*nb+gsg];
           }
-
-          //============================= Set flags and counters
-          if (face_incident) continue;
-          else out_face_counter++;
-
-          //============================= Store outgoing Psi Locally
-          if (face_neighbor == LOCAL)
+        }//
+        //============================= Store outgoing Psi Non-Locally
+        else if (face->kind == SweepPlan::FACE_NONLOCAL)
+        {
+          for (int fi=0; fi<face->num_dofs; fi++)
           {
-            for (int fi=0; fi<cell->faces[f].vertex_ids.size(); fi++)
-            {
-              int i = cell_fe_view->face_dof_mappings[f][fi];
-              psi = fluds->OutgoingPsi(cr_i,out_face_counter,fi,n);
+            int i = dof_map[fi];
+            float* psi_f = (single_precision)?
+              fluds->NLOutgoingPsiF(face->index,fi,n) : nullptr;
 
-              for (int gsg=0; gsg<gs_ss_size; gsg++)
-                psi[gsg] = b[gsg][i];
-            }
-          }//
-          //============================= Store outgoing Psi Non-Locally
-          else if ((face_neighbor != LOCAL) &&
-                   (face_neighbor >= 0))
-          {
-            deploc_face_counter++;
-            for (int fi=0; fi<cell->faces[f].vertex_ids.size(); fi++)
-            {
-              int i = cell_fe_view->face_dof_mappings[f][fi];
-              psi = fluds->NLOutgoingPsi(deploc_face_counter,fi,n);
-
-              for (int gsg=0; gsg<gs_ss_size; gsg++)
-                psi[gsg] = b[gsg][i];
-            }//for fdof
-          }//if non-local
-          //============================= Store outgoing reflecting Psi
-          else if ((face_neighbor != LOCAL) &&
-                   (face_neighbor < 0) &&
-                   (angle_set->ref_boundaries[bndry_map]->IsReflecting()))
-          {
-            for (int fi=0; fi<cell->faces[f].vertex_ids.size(); fi++)
+            if (psi_f)
             {
-              int i = cell_fe_view->face_dof_mappings[f][fi];
-              psi = angle_set->ReflectingPsiOutBoundBndry(bndry_map, angle_num,
-                                                          cell->cell_local_id,f,
-                                                          fi,gs_ss_begin);
-
-              for (int gsg=0; gsg<gs_ss_size; gsg++)
-                psi[gsg] = b[gsg][i];
-            }//for fdof
-          }//reflecting
-        }//for f
-
+              for (int gsg=0; gsg<nb; gsg++)
+                psi_f[gsg] = static_cast<float>(b[i*nb+gsg]);
+              continue;
+            }
 
-      }//for n
+            psi = fluds->NLOutgoingPsi(face->index,fi,n);
 
-    }// for cell
+            for (int gsg=0; gsg<nb; gsg++)
+              psi[gsg] = b[i*nb+gsg];
+          }//for fdof
+        }//if non-local
+        //============================= Store outgoing reflecting Psi
+        else
+        {
+          int bndry_map = transport_view->face_boundary_id[face->index];
+          if (!angle_set->ref_boundaries[bndry_map]->IsReflecting())
+            continue;
 
-  }//Sweep function
+          for (int fi=0; fi<face->num_dofs; fi++)
+          {
+            int i = dof_map[fi];
+            psi = angle_set->ReflectingPsiOutBoundBndry(bndry_map, angle_num,
+                                                        cd.cell_local_id,f,
+                                                        fi,gs_ss_begin);
+
+            for (int gsg=0; gsg<nb; gsg++)
+              psi[gsg] = b[i*nb+gsg];
+          }//for fdof
+        }//reflecting
+      }//for outgoing f
+
+    }//for n
+
+    //=================================================== Accumulate flux
+    double* phi_cell = sc.phi_cell.data();
+    std::fill(phi_cell,phi_cell+num_moms*K,0.0);
+    chi_math::MatMulAdd(num_moms,K,num_as_angles,
+                        d2m_as.data(),num_as_angles,
+                        sc.psi_all.data(),K,
+                        phi_cell,K);
+
+    for (int m=0; m<num_moms; m++)
+      for (int i=0; i<cell_dofs; i++)
+      {
+        double*       phi_img = &phi[pack->MapDOF(cd,i,m,gs_gi)];
+        const double* phi_mi  = &phi_cell[m*K+i*nb];
+        for (int gsg=0; gsg<nb; gsg++)
+          phi_img[gsg] += phi_mi[gsg];
+      }
+  }//SweepCell
 };//class def
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,91 @@
+#include "lbs_sweepdatapack.h"
+
+#include "ChiMesh/Cell/cell.h"
+
+//###################################################################
+/**Copies the transport-relevant data of all local cells into the pack,
+ * in the sweep order of the given SPDS.*/
+void LinearBoltzman::SweepDataPack::
+  Build(chi_mesh::sweep_management::SPDS* spds,
+        chi_mesh::MeshContinuum* grid,
+        SpatialDiscretization_PWL* discretization,
+        std::vector<CellViewBase*>& cell_transport_views,
+        std::vector<chi_physics::TransportCrossSections*>& xsections,
+        int num_groups, int num_moments)
+{
+  const std::vector<int>& item_id = spds->spls->item_id;
+  const size_t num_loc_cells = item_id.size();
+
+  phi_dof_stride = num_groups*num_moments;
+  phi_mom_stride = num_groups;
+
+  //============================================= Size the arena
+  cells.clear();
+  cells.reserve(num_loc_cells);
+  size_t arena_size = 0;
+  for (int cell_g_index : item_id)
+  {
+    auto cell_fe_view = discretization->MapFeView(cell_g_index);
+    size_t d  = cell_fe_view->dofs;
+    size_t nf = grid->cells[cell_g_index]->faces.size();
+    arena_size += (4+nf)*d*d + 3*nf;
+  }
+  arena.assign(arena_size,0.0);
+
+  //============================================= Fill in sweep order
+  size_t offset = 0;
+  for (size_t cr_i=0; cr_i<num_loc_cells; cr_i++)
+  {
+    int  cell_g_index   = item_id[cr_i];
+    auto cell           = grid->cells[cell_g_index];
+    auto cell_fe_view   = discretization->MapFeView(cell_g_index);
+    auto transport_view =
+      (CellViewFull*)cell_transport_views[cell->cell_local_id];
+
+    CellData cell_data;
+    cell_data.cell_local_id = cell->cell_local_id;
+    cell_data.num_dofs      = cell_fe_view->dofs;
+    cell_data.num_faces     = cell->faces.size();
+    cell_data.phi_map_start = transport_view->dof_phi_map_start;
+    cell_data.sigma_tg      = xsections[transport_view->xs_id]->sigma_tg.data();
+    cell_data.arena_start   = offset;
+
+    const int d  = cell_data.num_dofs;
+    const int nf = cell_data.num_faces;
+
+    double* block = &arena[offset];
+
+    for (int i=0; i<d; i++)
+      for (int j=0; j<d; j++)
+      {
+        const chi_mesh::Vector& Lij = cell_fe_view->IntV_shapeI_gradshapeJ[i][j];
+        block[3*(i*d+j)+0] = Lij.x;
+        block[3*(i*d+j)+1] = Lij.y;
+        block[3*(i*d+j)+2] = Lij.z;
+      }
+    block += 3*d*d;
+
+    for (int i=0; i<d; i++)
+      for (int j=0; j<d; j++)
+        block[i*d+j] = cell_fe_view->IntV_shapeI_shapeJ[i][j];
+    block += d*d;
+
+    for (int f=0; f<nf; f++)
+    {
+      for (int i=0; i<d; i++)
+        for (int j=0; j<d; j++)
+          block[i*d+j] = cell_fe_view->IntS_shapeI_shapeJ[f][i][j];
+      block += d*d;
+    }
+
+    for (int f=0; f<nf; f++)
+    {
+      block[3*f+0] = cell->faces[f].normal.x;
+      block[3*f+1] = cell->faces[f].normal.y;
+      block[3*f+2] = cell->faces[f].normal.z;
+    }
+
+    offset += (4+nf)*d*d + 3*nf;
+    cells.push_back(cell_data);
+  }
+}
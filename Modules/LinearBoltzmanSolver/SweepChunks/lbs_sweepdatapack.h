@@ -0,0 +1,71 @@
+#ifndef _lbs_sweepdatapack_h
+#define _lbs_sweepdatapack_h
+
+#include "ChiMesh/SweepUtilities/SPDS/SPDS.h"
+#include "ChiMesh/MeshContinuum/chi_meshcontinuum.h"
+#include "ChiMath/SpatialDiscretization/PiecewiseLinear/pwl.h"
+#include <ChiPhysics/PhysicsMaterial/property10_transportxsections.h>
+
+#include "../lbs_structs.h"
+
+#include <vector>
+
+namespace LinearBoltzman
+{
+
+//###################################################################
+/**Copy of the cell data needed by a sweep, laid out in the sweep order
+ * of one SPDS. The FE matrices of all the local cells live in a single
+ * contiguous arena so that a sweep streams through memory linearly
+ * instead of chasing the nested vectors of every CellFEView.
+ *
+ * For a cell with d dofs and F faces the arena block starting at
+ * CellData::arena_start holds, all row-major:
+ *  - L [d][d][3] IntV_shapeI_gradshapeJ,
+ *  - M [d][d]    IntV_shapeI_shapeJ,
+ *  - N [F][d][d] IntS_shapeI_shapeJ,
+ *  - n [F][3]    face normals.*/
+class SweepDataPack
+{
+public:
+  struct CellData
+  {
+    int           cell_local_id;
+    int           num_dofs;
+    int           num_faces;
+    int           phi_map_start;  ///< CellViewFull::dof_phi_map_start
+    const double* sigma_tg;       ///< Cell material's total cross-sections
+    size_t        arena_start;
+  };
+
+  std::vector<CellData> cells;    ///< Indexed by sweep order cr_i
+  std::vector<double>   arena;
+
+  int phi_dof_stride = 0;         ///< Stride between dofs in phi
+  int phi_mom_stride = 0;         ///< Stride between moments in phi
+
+public:
+  void Build(chi_mesh::sweep_management::SPDS* spds,
+             chi_mesh::MeshContinuum* grid,
+             SpatialDiscretization_PWL* discretization,
+             std::vector<CellViewBase*>& cell_transport_views,
+             std::vector<chi_physics::TransportCrossSections*>& xsections,
+             int num_groups, int num_moments);
+
+  const double* L(const CellData& c) const
+  {return &arena[c.arena_start];}
+  const double* M(const CellData& c) const
+  {return &arena[c.arena_start + 3*c.num_dofs*c.num_dofs];}
+  const double* N(const CellData& c, int f) const
+  {return &arena[c.arena_start + (4+f)*c.num_dofs*c.num_dofs];}
+  const double* Normal(const CellData& c, int f) const
+  {return &arena[c.arena_start + (4+c.num_faces)*c.num_dofs*c.num_dofs + 3*f];}
+
+  /**Index into phi of a cell dof, moment and group.*/
+  int MapDOF(const CellData& c, int dof, int moment, int grp) const
+  {return c.phi_map_start + dof*phi_dof_stride + moment*phi_mom_stride + grp;}
+};
+
+}
+
+#endif
@@ -0,0 +1,159 @@
+#include "../lbs_linear_boltzman_solver.h"
+
+#include "ChiMesh/SweepUtilities/SweepScheduler/sweepscheduler.h"
+
+#include "krylov_state.h"
+#include "../IterativeOperations/lbs_matrixaction_Ax.h"
+
+//###################################################################
+/**Creates the shell matrix, the vectors and the KSP.*/
+void LBSKrylovState::Create(int in_local_size, int in_globl_size)
+{
+  local_size = in_local_size;
+  globl_size = in_globl_size;
+
+  //================================================== Create the matrix
+  MatCreateShell(PETSC_COMM_WORLD,local_size,
+                                  local_size,
+                                  globl_size,
+                                  globl_size,
+                                  &data_context,&A);
+  MatShellSetOperation(A, MATOP_MULT,(void (*)(void)) NPTMatrixAction_Ax);
+
+  //================================================== Create vectors
+  VecCreate(PETSC_COMM_WORLD,&phi_new);
+  VecSetSizes(phi_new,
+              local_size,     //Local size
+              globl_size);    //Global size
+  VecSetType(phi_new,VECMPI);
+  VecSet(phi_new,0.0);
+  VecDuplicate(phi_new,&phi_old);
+  VecDuplicate(phi_new,&q_fixed);
+  VecDuplicate(phi_new,&work);
+  VecDuplicate(phi_new,&data_context.x_temp);
+
+  //================================================== Create Krylov Solver
+  KSPCreate(PETSC_COMM_WORLD, &ksp);
+  KSPSetOperators(ksp,A,A);
+  data_context.krylov_solver = ksp;
+}
+
+//###################################################################
+/**Destroys all PETSc objects, including the stored solutions.*/
+void LBSKrylovState::Destroy()
+{
+  ClearSolutions();
+
+  if (ksp != nullptr) KSPDestroy(&ksp);
+  if (phi_new != nullptr) VecDestroy(&phi_new);
+  if (phi_old != nullptr) VecDestroy(&phi_old);
+  if (q_fixed != nullptr) VecDestroy(&q_fixed);
+  if (work    != nullptr) VecDestroy(&work);
+  if (data_context.x_temp != nullptr) VecDestroy(&data_context.x_temp);
+  if (A != nullptr) MatDestroy(&A);
+
+  ksp     = nullptr;
+  phi_new = nullptr;
+  phi_old = nullptr;
+  q_fixed = nullptr;
+  work    = nullptr;
+  A       = nullptr;
+  data_context.x_temp = nullptr;
+}
+
+//###################################################################
+/**Computes the minimum residual initial guess over the stored
+ * solutions. Returns false, leaving x0 untouched, when no solutions
+ * are stored.*/
+bool LBSKrylovState::FormInitialGuess(Vec b, Vec x0)
+{
+  if (guess_x.empty()) return false;
+
+  VecSet(x0,0.0);
+  for (size_t j=0; j<guess_x.size(); j++)
+  {
+    double coeff = 0.0;
+    VecDot(guess_Ax[j],b,&coeff);
+    VecAXPY(x0,coeff,guess_x[j]);
+  }
+
+  return true;
+}
+
+//###################################################################
+/**Adds a solution to the recycled subspace. This requires one
+ * application of the operator, hence one sweep. The action is
+ * orthonormalized against the stored actions with modified
+ * Gram-Schmidt, applying the same combinations to the solution.
+ * When max_num_vectors are stored the oldest pair is dropped, the
+ * remaining actions stay orthonormal.*/
+void LBSKrylovState::AddSolution(Vec x, int max_num_vectors)
+{
+  if (max_num_vectors <= 0) return;
+
+  Vec new_x, new_Ax;
+  VecDuplicate(x,&new_x);
+  VecDuplicate(x,&new_Ax);
+  VecCopy(x,new_x);
+  MatMult(A,new_x,new_Ax);
+
+  double Ax_norm_initial = 0.0;
+  VecNorm(new_Ax,NORM_2,&Ax_norm_initial);
+
+  for (size_t j=0; j<guess_Ax.size(); j++)
+  {
+    double h = 0.0;
+    VecDot(new_Ax,guess_Ax[j],&h);
+    VecAXPY(new_Ax,-h,guess_Ax[j]);
+    VecAXPY(new_x ,-h,guess_x[j]);
+  }
+
+  double Ax_norm = 0.0;
+  VecNorm(new_Ax,NORM_2,&Ax_norm);
+
+  //=================================== Discard linearly dependent
+  if (Ax_norm <= 1.0e-12*Ax_norm_initial or Ax_norm == 0.0)
+  {
+    VecDestroy(&new_x);
+    VecDestroy(&new_Ax);
+    return;
+  }
+
+  VecScale(new_x ,1.0/Ax_norm);
+  VecScale(new_Ax,1.0/Ax_norm);
+
+  //=================================== Drop oldest
+  if (guess_x.size() >= (size_t)max_num_vectors)
+  {
+    VecDestroy(&guess_x.front());
+    VecDestroy(&guess_Ax.front());
+    guess_x.erase(guess_x.begin());
+    guess_Ax.erase(guess_Ax.begin());
+  }
+
+  guess_x.push_back(new_x);
+  guess_Ax.push_back(new_Ax);
+}
+
+//###################################################################
+/**Discards all stored solutions.*/
+void LBSKrylovState::ClearSolutions()
+{
+  for (auto& v : guess_x)  VecDestroy(&v);
+  for (auto& v : guess_Ax) VecDestroy(&v);
+  guess_x.clear();
+  guess_Ax.clear();
+}
+
+//###################################################################
+/**Computes ||b - A x||. This requires one application of the operator,
+ * hence one sweep.*/
+double LBSKrylovState::ResidualNorm(Vec b, Vec x)
+{
+  double residual_norm = 0.0;
+  MatMult(A,x,work);
+  VecAYPX(work,-1.0,b);
+  VecNorm(work,NORM_2,&residual_norm);
+
+  return residual_norm;
+}
@@ -0,0 +1,48 @@
+#ifndef _lbs_krylov_state_h
+#define _lbs_krylov_state_h
+
+#include "ksp_data_context.h"
+
+#include <petscksp.h>
+
+#include <vector>
+
+//###################################################################
+/**Krylov solver of a groupset that is kept alive across executions.
+ * The shell matrix, the KSP and the vectors are created once and only
+ * recreated when the number of unknowns changes.
+ *
+ * Previous solutions are kept as a recycled subspace for the initial
+ * guess. For every stored solution x_j the action y_j = A x_j is
+ * stored as well, orthonormalized such that the y_j form an orthonormal
+ * basis. The guess x0 = sum_j (y_j,b) x_j then minimizes the residual
+ * ||b - A x|| over the span of the stored solutions, provided the
+ * operator did not change since they were stored. Since cross sections
+ * or boundary conditions may change between executions the guess is
+ * only used after checking its actual residual.*/
+struct LBSKrylovState
+{
+  Mat             A       = nullptr;
+  KSP             ksp     = nullptr;
+  Vec             phi_new = nullptr;
+  Vec             phi_old = nullptr;
+  Vec             q_fixed = nullptr;
+  Vec             work    = nullptr;
+  KSPDataContext  data_context;
+
+  int             local_size = 0;
+  int             globl_size = 0;
+
+  std::vector<Vec> guess_x;   ///< Stored solutions
+  std::vector<Vec> guess_Ax;  ///< Orthonormal actions of the solutions
+
+  void Create(int in_local_size, int in_globl_size);
+  void Destroy();
+
+  bool   FormInitialGuess(Vec b, Vec x0);
+  void   AddSolution(Vec x, int max_num_vectors);
+  void   ClearSolutions();
+  double ResidualNorm(Vec b, Vec x);
+};
+
+#endif
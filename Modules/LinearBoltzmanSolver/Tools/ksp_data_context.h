@@ -1,4 +1,5 @@
-
+#ifndef _lbs_ksp_data_context_h
+#define _lbs_ksp_data_context_h
 
 //###################################################################
 /**This is a simple data structure of basically pointers to
@@ -13,4 +14,10 @@ struct KSPDataContext
   Vec              x_temp;
   chi_mesh::sweep_management::SweepScheduler* sweepScheduler;
   int last_iteration = -1;
-};
\ No newline at end of file
+
+  bool apply_dsa_in_action = true;  ///< False when DSA is the preconditioner
+  bool flexible_dsa = false;        ///< Relax DSA tolerances (FGMRES)
+  std::vector<double> dsa_phi_zero;
+};
+
+#endif
\ No newline at end of file
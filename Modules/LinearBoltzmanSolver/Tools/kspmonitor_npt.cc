@@ -82,7 +82,9 @@ KSPConvergenceTestNPT(KSP ksp, PetscInt n, PetscReal rnorm,
 
   chi_log.Log(LOG_0) << iter_info.str() << std::endl;
 
-  if (context->groupset->iterative_method == NPT_GMRES)
+  if ((context->groupset->iterative_method == NPT_GMRES) or
+      (context->groupset->iterative_method == NPT_FGMRES) or
+      (context->groupset->iterative_method == NPT_LGMRES))
   {
     if (context->last_iteration == n)
     {
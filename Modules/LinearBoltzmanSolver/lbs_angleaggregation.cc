@@ -48,8 +48,6 @@ void LinearBoltzman::Solver::InitAngleAggPolar(LBSGroupset *groupset)
 
     for (int azi=0; azi<num_azi/num_angset_grps; azi++)
     {
-      bool make_primary = true;
-      chi_mesh::sweep_management::PRIMARY_FLUDS* primary_fluds;
 
       for (int gs_ss=0; gs_ss<groupset->grp_subsets.size(); gs_ss++)
       {
@@ -66,22 +64,10 @@ void LinearBoltzman::Solver::InitAngleAggPolar(LBSGroupset *groupset)
             angle_indices.push_back(angle_num);
           }//for pr
 
-          chi_mesh::sweep_management::FLUDS* fluds;
-          if (make_primary)
-          {
-            make_primary = false;
-            primary_fluds = new chi_mesh::sweep_management::
-                  PRIMARY_FLUDS(groupset->grp_subset_sizes[gs_ss]);
-
-            primary_fluds->InitializeAlphaElements(sweep_orderings[a]);
-            primary_fluds->InitializeBetaElements(sweep_orderings[a]);
-
-            fluds = primary_fluds;
-          } else
-          {
-            fluds = new chi_mesh::sweep_management::
-              AUX_FLUDS(*primary_fluds,groupset->grp_subset_sizes[gs_ss]);
-          }
+          chi_mesh::sweep_management::FLUDS* fluds =
+            new chi_mesh::sweep_management::
+              AUX_FLUDS(*GetPrimaryFLUDS(a),
+                        groupset->grp_subset_sizes[gs_ss]);
 
           auto angleSet =
             new TAngleSet(groupset->grp_subset_sizes[gs_ss],
@@ -91,7 +77,8 @@ void LinearBoltzman::Solver::InitAngleAggPolar(LBSGroupset *groupset)
                           angle_indices,
                           sweep_boundaries,
                           options.sweep_eager_limit,
-                          &comm_set);
+                          &comm_set,
+                          groupset->single_precision_psi);
 
           angle_set_group->angle_sets.push_back(angleSet);
         }//for an_ss
@@ -105,8 +92,6 @@ void LinearBoltzman::Solver::InitAngleAggPolar(LBSGroupset *groupset)
 
     for (int azi=0; azi<num_azi/num_angset_grps; azi++)
     {
-      bool make_primary = true;
-      chi_mesh::sweep_management::PRIMARY_FLUDS* primary_fluds;
 
       for (int gs_ss=0; gs_ss<groupset->grp_subsets.size(); gs_ss++)
       {
@@ -123,22 +108,10 @@ void LinearBoltzman::Solver::InitAngleAggPolar(LBSGroupset *groupset)
             angle_indices.push_back(angle_num);
           }//for pr
 
-          chi_mesh::sweep_management::FLUDS* fluds;
-          if (make_primary)
-          {
-            make_primary = false;
-            primary_fluds = new chi_mesh::sweep_management::
-            PRIMARY_FLUDS(groupset->grp_subset_sizes[gs_ss]);
-
-            primary_fluds->InitializeAlphaElements(sweep_orderings[a+num_azi]);
-            primary_fluds->InitializeBetaElements(sweep_orderings[a+num_azi]);
-
-            fluds = primary_fluds;
-          } else
-          {
-            fluds = new chi_mesh::sweep_management::
-            AUX_FLUDS(*primary_fluds,groupset->grp_subset_sizes[gs_ss]);
-          }
+          chi_mesh::sweep_management::FLUDS* fluds =
+            new chi_mesh::sweep_management::
+              AUX_FLUDS(*GetPrimaryFLUDS(a+num_azi),
+                        groupset->grp_subset_sizes[gs_ss]);
 
           auto angleSet =
             new TAngleSet(groupset->grp_subset_sizes[gs_ss],
@@ -148,7 +121,8 @@ void LinearBoltzman::Solver::InitAngleAggPolar(LBSGroupset *groupset)
                           angle_indices,
                           sweep_boundaries,
                           options.sweep_eager_limit,
-                          &comm_set);
+                          &comm_set,
+                          groupset->single_precision_psi);
 
           angle_set_group->angle_sets.push_back(angleSet);
         }//for an_ss
@@ -191,8 +165,6 @@ void LinearBoltzman::Solver::InitAngleAggSingle(LBSGroupset *groupset)
 
     for (int azi=0; azi<num_azi/num_angset_grps; azi++)
     {
-      bool make_primary = true;
-      chi_mesh::sweep_management::PRIMARY_FLUDS* primary_fluds;
 
       for (int pr=0; pr<pa; pr++)
       {
@@ -206,22 +178,10 @@ void LinearBoltzman::Solver::InitAngleAggSingle(LBSGroupset *groupset)
           int angle_num = groupset->quadrature->GetAngleNum(p,a);
           angle_indices.push_back(angle_num);
 
-          chi_mesh::sweep_management::FLUDS* fluds;
-          if (make_primary)
-          {
-            make_primary = false;
-            primary_fluds = new chi_mesh::sweep_management::
-            PRIMARY_FLUDS(groupset->grp_subset_sizes[gs_ss]);
-
-            primary_fluds->InitializeAlphaElements(sweep_orderings[a]);
-            primary_fluds->InitializeBetaElements(sweep_orderings[a]);
-
-            fluds = primary_fluds;
-          } else
-          {
-            fluds = new chi_mesh::sweep_management::
-            AUX_FLUDS(*primary_fluds,groupset->grp_subset_sizes[gs_ss]);
-          }
+          chi_mesh::sweep_management::FLUDS* fluds =
+            new chi_mesh::sweep_management::
+              AUX_FLUDS(*GetPrimaryFLUDS(a),
+                        groupset->grp_subset_sizes[gs_ss]);
 
           auto angleSet =
             new TAngleSet(groupset->grp_subset_sizes[gs_ss],
@@ -231,7 +191,8 @@ void LinearBoltzman::Solver::InitAngleAggSingle(LBSGroupset *groupset)
                           angle_indices,
                           sweep_boundaries,
                           options.sweep_eager_limit,
-                          &comm_set);
+                          &comm_set,
+                          groupset->single_precision_psi);
 
           angle_set_group->angle_sets.push_back(angleSet);
         }
@@ -247,8 +208,6 @@ void LinearBoltzman::Solver::InitAngleAggSingle(LBSGroupset *groupset)
 
     for (int azi=0; azi<num_azi/num_angset_grps; azi++)
     {
-      bool make_primary = true;
-      chi_mesh::sweep_management::PRIMARY_FLUDS* primary_fluds;
 
       for (int pr=0; pr<pa; pr++)
       {
@@ -262,22 +221,10 @@ void LinearBoltzman::Solver::InitAngleAggSingle(LBSGroupset *groupset)
           int angle_num = groupset->quadrature->GetAngleNum(p,a);
           angle_indices.push_back(angle_num);
 
-          chi_mesh::sweep_management::FLUDS* fluds;
-          if (make_primary)
-          {
-            make_primary = false;
-            primary_fluds = new chi_mesh::sweep_management::
-            PRIMARY_FLUDS(groupset->grp_subset_sizes[gs_ss]);
-
-            primary_fluds->InitializeAlphaElements(sweep_orderings[a+num_azi]);
-            primary_fluds->InitializeBetaElements(sweep_orderings[a+num_azi]);
-
-            fluds = primary_fluds;
-          } else
-          {
-            fluds = new chi_mesh::sweep_management::
-            AUX_FLUDS(*primary_fluds,groupset->grp_subset_sizes[gs_ss]);
-          }
+          chi_mesh::sweep_management::FLUDS* fluds =
+            new chi_mesh::sweep_management::
+              AUX_FLUDS(*GetPrimaryFLUDS(a+num_azi),
+                        groupset->grp_subset_sizes[gs_ss]);
 
           auto angleSet =
             new TAngleSet(groupset->grp_subset_sizes[gs_ss],
@@ -287,7 +234,8 @@ void LinearBoltzman::Solver::InitAngleAggSingle(LBSGroupset *groupset)
                           angle_indices,
                           sweep_boundaries,
                           options.sweep_eager_limit,
-                          &comm_set);
+                          &comm_set,
+                          groupset->single_precision_psi);
 
           angle_set_group->angle_sets.push_back(angleSet);
         }
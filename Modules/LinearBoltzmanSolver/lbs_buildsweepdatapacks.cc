@@ -0,0 +1,53 @@
+#include "lbs_linear_boltzman_solver.h"
+
+#include <chi_log.h>
+#include "ChiTimer/chi_timer.h"
+
+extern ChiLog chi_log;
+extern ChiTimer chi_program_timer;
+
+//###################################################################
+/**Builds the sweep data pack of every sweep ordering. A pack holds the
+ * cell data read by the sweep chunk contiguously in the sweep order of
+ * its SPDS.
+ *
+ * Packs are stored with the current sweep structures and only built
+ * for sweep orderings that do not have one yet. They depend on the
+ * total number of groups and moments, not on the groupset, hence a
+ * groupset reusing cached sweep orderings also reuses their packs.*/
+void LinearBoltzman::Solver::BuildSweepDataPacks()
+{
+  if (sweep_structures == nullptr)
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "LinearBoltzman::Solver::BuildSweepDataPacks: Sweep orderings "
+      << "must be computed before the sweep data packs.";
+    exit(EXIT_FAILURE);
+  }
+
+  auto& cached_packs = sweep_structures->sweep_data_packs;
+
+  size_t num_built = 0;
+  for (auto spds : sweep_orderings)
+  {
+    if (cached_packs.find(spds) != cached_packs.end()) continue;
+
+    auto pack = new SweepDataPack;
+    pack->Build(spds,
+                grid,
+                (SpatialDiscretization_PWL*)discretization,
+                cell_transport_views,
+                material_xs,
+                groups.size(),
+                num_moments);
+    cached_packs[spds] = pack;
+    ++num_built;
+  }
+
+  sweep_data_packs = cached_packs;
+
+  chi_log.Log(LOG_0VERBOSE_1)
+    << chi_program_timer.GetTimeString()
+    << " Sweep data packs built: " << num_built
+    << ", reused: " << sweep_orderings.size() - num_built;
+}
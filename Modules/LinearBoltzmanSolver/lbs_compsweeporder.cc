@@ -23,13 +23,11 @@ typedef chi_mesh::sweep_management::AngleSetGroup TAngleSetGroup;
 extern ChiConsole chi_console;
 
 //###################################################################
-/**Initializes the sweep ordering for the given groupset.*/
+/**Initializes the sweep ordering for the given groupset. Sweep
+ * orderings are cached, a groupset with the same quadrature and
+ * sweep settings as an earlier groupset reuses its orderings.*/
 void LinearBoltzman::Solver::ComputeSweepOrderings(LBSGroupset *groupset)
 {
-  chi_log.Log(LOG_0)
-    << chi_program_timer.GetTimeString()
-    << " Computing Sweep ordering.\n";
-
   //============================================= Clear sweep ordering
   sweep_orderings.clear();
   sweep_orderings.shrink_to_fit();
@@ -37,6 +35,32 @@ void LinearBoltzman::Solver::ComputeSweepOrderings(LBSGroupset *groupset)
   chi_mesh::MeshHandler*    mesh_handler = chi_mesh::GetCurrentHandler();
   chi_mesh::VolumeMesher*         mesher = mesh_handler->volume_mesher;
 
+  //Level ordered sweeps are only needed for level threading
+  const bool level_ordering = options.sweep_level_threads > 1;
+
+  //============================================= Check the cache
+  SweepStructuresKey key(grid,
+                         groupset->quadrature,
+                         groupset->allow_cycles,
+                         level_ordering);
+  auto cached = sweep_structures_cache.find(key);
+  if (cached != sweep_structures_cache.end())
+  {
+    chi_log.Log(LOG_0)
+      << chi_program_timer.GetTimeString()
+      << " Reusing cached sweep orderings.";
+
+    sweep_structures = &cached->second;
+    sweep_orderings  = sweep_structures->sweep_orderings;
+
+    BuildSweepDataPacks();
+    return;
+  }
+
+  chi_log.Log(LOG_0)
+    << chi_program_timer.GetTimeString()
+    << " Computing Sweep ordering.\n";
+
   //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%% 1D MESHES
   if (typeid(*mesher) == typeid(chi_mesh::VolumeMesherLinemesh1D))
   {
@@ -57,7 +81,8 @@ void LinearBoltzman::Solver::ComputeSweepOrderings(LBSGroupset *groupset)
       CreateSweepOrder(groupset->quadrature->polar_ang[0],
                        groupset->quadrature->azimu_ang[0],
                        this->grid,
-                       groupset->allow_cycles);
+                       groupset->allow_cycles,
+                       level_ordering);
     this->sweep_orderings.push_back(new_swp_order);
 
     new_swp_order =
@@ -65,7 +90,8 @@ void LinearBoltzman::Solver::ComputeSweepOrderings(LBSGroupset *groupset)
       CreateSweepOrder(groupset->quadrature->polar_ang[pa],
                        groupset->quadrature->azimu_ang[0],
                        this->grid,
-                       groupset->allow_cycles);
+                       groupset->allow_cycles,
+                       level_ordering);
     this->sweep_orderings.push_back(new_swp_order);
   }
   //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%% 2D 3D MESHES
@@ -103,7 +129,8 @@ void LinearBoltzman::Solver::ComputeSweepOrderings(LBSGroupset *groupset)
                   CreateSweepOrder(groupset->quadrature->polar_ang[pa-1],
                                    groupset->quadrature->azimu_ang[i],
                                    this->grid,
-                                   groupset->allow_cycles);
+                                   groupset->allow_cycles,
+                                   level_ordering);
       this->sweep_orderings.push_back(new_swp_order);
     }
     //=========================================== BOTTOM HEMISPHERE
@@ -114,7 +141,8 @@ void LinearBoltzman::Solver::ComputeSweepOrderings(LBSGroupset *groupset)
         CreateSweepOrder(groupset->quadrature->polar_ang[pa],
                          groupset->quadrature->azimu_ang[i],
                          this->grid,
-                         groupset->allow_cycles);
+                         groupset->allow_cycles,
+                         level_ordering);
       this->sweep_orderings.push_back(new_swp_order);
     }
 
@@ -126,6 +154,12 @@ void LinearBoltzman::Solver::ComputeSweepOrderings(LBSGroupset *groupset)
     exit(EXIT_FAILURE);
   }
 
+  //============================================= Add to cache
+  sweep_structures = &sweep_structures_cache[key];
+  sweep_structures->sweep_orderings = sweep_orderings;
+  sweep_structures->primary_fluds.assign(sweep_orderings.size(),nullptr);
+
+  BuildSweepDataPacks();
 
   chi_log.Log(LOG_0)
     << chi_program_timer.GetTimeString()
@@ -16,4 +16,12 @@ LinearBoltzman::Solver::Solver()
 
   boundary_types.resize(6,
     std::pair<BoundaryType,int>(LinearBoltzman::BoundaryType::VACUUM,-1));
-}
\ No newline at end of file
+}
+
+//###################################################################
+/**Destructor for NPT. Releases the cached sweep orderings, primary
+ * FLUDS and sweep data packs. These hold no PETSc objects.*/
+LinearBoltzman::Solver::~Solver()
+{
+  ClearSweepStructures();
+}
@@ -11,6 +11,10 @@
 #include "ChiMesh/SweepUtilities/sweep_namespace.h"
 #include "ChiMesh/SweepUtilities/SweepBoundary/sweep_boundaries.h"
 #include "ChiMath/SparseMatrix/chi_math_sparse_matrix.h"
+#include "SweepChunks/lbs_sweepdatapack.h"
+
+#include <map>
+#include <tuple>
 
 #include <petscksp.h>
 
@@ -64,8 +68,27 @@ public:
   std::vector<std::pair<BoundaryType, int>>     boundary_types;
   std::vector<std::vector<double>>              incident_P0_mg_boundaries;
   std::vector<chi_mesh::sweep_management::SPDS*> sweep_orderings;
+  typedef std::map<chi_mesh::sweep_management::SPDS*,
+                   SweepDataPack*>              SweepDataPackMap;
+  SweepDataPackMap                              sweep_data_packs;
   std::vector<SweepBndry*>                      sweep_boundaries;
 
+  //Sweep orderings, their primary FLUDS and sweep data packs are kept
+  //alive across groupsets and executions. Key: grid, quadrature,
+  //allow_cycles and level ordering. The solver's sweep_data_packs only
+  //refers to the packs of the current sweep structures.
+  typedef std::tuple<chi_mesh::MeshContinuum*,
+                     chi_math::ProductQuadrature*,
+                     bool, bool>                SweepStructuresKey;
+  struct SweepStructures
+  {
+    std::vector<chi_mesh::sweep_management::SPDS*>          sweep_orderings;
+    std::vector<chi_mesh::sweep_management::PRIMARY_FLUDS*> primary_fluds;
+    SweepDataPackMap                                        sweep_data_packs;
+  };
+  std::map<SweepStructuresKey,SweepStructures>  sweep_structures_cache;
+  SweepStructures*                              sweep_structures = nullptr;
+
   ChiMPICommunicatorSet comm_set;
 
   int max_cell_dof_count;
@@ -83,6 +106,7 @@ public:
  public:
   //00
   Solver();
+ ~Solver();
   //01
   void Initialize();
   //01a
@@ -99,11 +123,13 @@ public:
 
   //03a
   void ComputeSweepOrderings(LBSGroupset *groupset);
+  void BuildSweepDataPacks();
   //03b
   void InitFluxDataStructures(LBSGroupset *groupset);
   //03c
   void InitAngleAggPolar(LBSGroupset *groupset);
   void InitAngleAggSingle(LBSGroupset *groupset);
+  chi_mesh::sweep_management::PRIMARY_FLUDS* GetPrimaryFLUDS(int so_index);
   //03d
   void InitWGDSA(LBSGroupset *groupset);
   void AssembleWGDSADeltaPhiVector(LBSGroupset *groupset, double *ref_phi_old,
@@ -121,6 +147,7 @@ public:
 
   //04c
   void ResetSweepOrderings(LBSGroupset *groupset);
+  void ClearSweepStructures();
 
   //05
   void WriteRestartData(std::string folder_name, std::string file_base);
@@ -55,7 +55,9 @@ void LinearBoltzman::Solver::SolveGroupset(int group_set_num)
   {
     ClassicRichardson(group_set_num);
   }
-  else if (group_set->iterative_method == NPT_GMRES)
+  else if ((group_set->iterative_method == NPT_GMRES) or
+           (group_set->iterative_method == NPT_FGMRES) or
+           (group_set->iterative_method == NPT_LGMRES))
   {
     GMRES(group_set_num);
   }
@@ -29,6 +29,10 @@ void LinearBoltzman::Solver::Initialize()
     exit(EXIT_FAILURE);
   }
 
+  //============================================= Release sweep structures
+  //                                              of a previous mesh
+  ClearSweepStructures();
+
   ComputeNumberOfMoments();
 
   if (chi_mpi.location_id == 0)
@@ -12,23 +12,19 @@ extern ChiMPI chi_mpi;
 extern ChiLog chi_log;
 
 //###################################################################
-/**Clears all the sweep orderings for a groupset in preperation for
- * another.*/
+/**Clears the angle aggregation of a groupset in preperation for
+ * another. The sweep orderings, primary FLUDS and sweep data packs
+ * remain in the sweep structure cache for reuse by other groupsets, see
+ * ClearSweepStructures.*/
 void LinearBoltzman::Solver::ResetSweepOrderings(LBSGroupset *groupset)
 {
   chi_log.Log(LOG_0VERBOSE_1)
-    << "Resetting SPDS and FLUDS";
-  for (int so=0; so<sweep_orderings.size(); so++)
-  {
-    chi_mesh::sweep_management::SPDS* cur_so =
-      sweep_orderings[so];
-
-    //delete cur_so->spls->fluds;
-    delete cur_so->spls;
-    delete cur_so;
-  }
+    << "Resetting angle aggregation";
 
   sweep_orderings.clear();
+  sweep_structures = nullptr;
+
+  sweep_data_packs.clear();
 
   chi_mesh::sweep_management::AngleAggregation* angle_agg = groupset->angle_agg;
 
@@ -50,11 +46,12 @@ void LinearBoltzman::Solver::ResetSweepOrderings(LBSGroupset *groupset)
   }
   angle_agg->angle_set_groups.clear();
   delete angle_agg;
+  groupset->angle_agg = new AngleAgg;
 
   MPI_Barrier(MPI_COMM_WORLD);
 
   chi_log.Log(LOG_0)
-    << "SPDS and FLUDS reset complete.            Process memory = "
+    << "Angle aggregation reset complete.         Process memory = "
     << std::setprecision(3)
     << chi_console.GetMemoryUsageInMB() << " MB";
 
@@ -15,6 +15,11 @@ struct Options
   int  scattering_order;
   int  partition_method;
   int  sweep_eager_limit;
+  int  sweep_num_threads;
+  int  sweep_level_threads;
+  bool sweep_aggregate_messages;
+  bool sweep_event_driven;
+  int  sweep_scheduler;
 
   bool read_restart_data;
   std::string read_restart_folder_name;
@@ -30,6 +35,11 @@ struct Options
     scattering_order = 0;
     partition_method = PARTITION_METHOD_SERIAL;
     sweep_eager_limit= 32000;
+    sweep_num_threads= 1;
+    sweep_level_threads= 1;
+    sweep_aggregate_messages= false;
+    sweep_event_driven= false;
+    sweep_scheduler= 2; //DEPTH_OF_GRAPH
 
     read_restart_data = false;
     read_restart_folder_name = std::string("YRestart");
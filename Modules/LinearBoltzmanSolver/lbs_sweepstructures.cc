@@ -0,0 +1,76 @@
+#include "lbs_linear_boltzman_solver.h"
+
+#include <ChiMesh/SweepUtilities/SPDS/SPDS.h>
+#include <ChiMesh/SweepUtilities/FLUDS/FLUDS.h>
+
+#include <chi_log.h>
+
+extern ChiLog chi_log;
+
+//###################################################################
+/**Returns the primary FLUDS of sweep ordering so_index of the current
+ * sweep structures. The alpha and beta elements are computed the first
+ * time the FLUDS is requested and then kept with the sweep ordering.
+ * Angle sets only use auxiliary FLUDS referring to it.
+ *
+ * The beta pass communicates with neighboring locations, hence all
+ * locations must request the FLUDS in the same order.*/
+chi_mesh::sweep_management::PRIMARY_FLUDS*
+  LinearBoltzman::Solver::GetPrimaryFLUDS(int so_index)
+{
+  if ((sweep_structures == nullptr) or
+      (so_index < 0) or
+      (so_index >= sweep_structures->primary_fluds.size()))
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "LinearBoltzman::Solver::GetPrimaryFLUDS: Sweep ordering "
+      << so_index << " not available. Sweep orderings must be computed "
+      << "before the flux data structures.";
+    exit(EXIT_FAILURE);
+  }
+
+  auto& primary_fluds = sweep_structures->primary_fluds[so_index];
+  if (primary_fluds == nullptr)
+  {
+    auto spds = sweep_structures->sweep_orderings[so_index];
+
+    //The group count of the primary FLUDS is never used, the
+    //auxiliary FLUDS carry their own group subset size.
+    primary_fluds = new chi_mesh::sweep_management::PRIMARY_FLUDS(1);
+    primary_fluds->InitializeAlphaElements(spds);
+    primary_fluds->InitializeBetaElements(spds);
+  }
+
+  return primary_fluds;
+}
+
+//###################################################################
+/**Deletes all cached sweep orderings, their primary FLUDS and sweep
+ * data packs. No angle aggregation may refer to them anymore. Since the
+ * packs copy the cross-section pointers and phi mapping of every cell,
+ * this must be called whenever the materials or cell views are
+ * rebuilt, see Initialize.*/
+void LinearBoltzman::Solver::ClearSweepStructures()
+{
+  for (auto& key_structures : sweep_structures_cache)
+  {
+    auto& structures = key_structures.second;
+
+    for (auto fluds : structures.primary_fluds)
+      delete fluds;
+
+    for (auto& spds_pack : structures.sweep_data_packs)
+      delete spds_pack.second;
+
+    for (auto spds : structures.sweep_orderings)
+    {
+      delete spds->spls;
+      delete spds;
+    }
+  }
+  sweep_structures_cache.clear();
+  sweep_structures = nullptr;
+
+  sweep_orderings.clear();
+  sweep_data_packs.clear();
+}
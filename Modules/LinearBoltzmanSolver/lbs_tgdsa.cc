@@ -84,12 +84,16 @@ void LinearBoltzman::Solver::InitTGDSA(LBSGroupset *groupset)
     dsolver->gi = 0;
 
     //================================= Initialize solver, assemble matrix A
-    //                                  but suppress solution
-    bool verbose          = groupset->tgdsa_verbose;   //Disable normal info printing
-    bool supress_assembly = false;   //Assemble the matrix
-    bool supress_solver   = true;    //Suppress the solving
-    dsolver->Initialize(verbose);
-    dsolver->ExecuteS(supress_assembly,supress_solver);
+    //                                  and set up the preconditioner once.
+    //                                  Applications only assemble the rhs.
+    //                                  Krylov methods need the DSA solve
+    //                                  to be a fixed operator, hence the
+    //                                  previous solution is only used as
+    //                                  initial guess by Richardson.
+    bool verbose = groupset->tgdsa_verbose;   //Disable normal info printing
+    dsolver->reuse_initial_guess =
+      (groupset->iterative_method == NPT_CLASSICRICHARDSON);
+    dsolver->SetupOperator(verbose);
 
     delta_phi_local.resize(0);
     delta_phi_local.shrink_to_fit();
@@ -101,7 +105,10 @@ void LinearBoltzman::Solver::InitTGDSA(LBSGroupset *groupset)
 void LinearBoltzman::Solver::CleanUpTGDSA(LBSGroupset *groupset)
 {
   if (groupset->apply_tgdsa)
+  {
+    ((chi_diffusion::Solver*)groupset->tgdsa_solver)->PrintOperatorTimings();
     delete groupset->tgdsa_solver;
+  }
 }
 
 //###################################################################
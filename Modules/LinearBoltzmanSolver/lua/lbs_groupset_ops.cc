@@ -676,6 +676,22 @@ NPT_GMRES_CYCLES\n
 Generalized Minimal Residual formulation for iterations with cyclic dependency
 convergence.\n\n
 
+NPT_FGMRES\n
+Flexible GMRES with WGDSA/TGDSA applied as right preconditioner. The
+tolerance of the diffusion solves is relaxed as the outer residual
+decreases.\n\n
+
+NPT_FGMRES_CYCLES\n
+Flexible GMRES, as NPT_FGMRES, with cyclic dependency convergence.\n\n
+
+NPT_LGMRES\n
+Loose GMRES (PETSc KSPLGMRES). Every restart cycle is augmented with
+approximations of the errors of the previous cycles, which reduces the
+stagnation of restarted GMRES.\n\n
+
+NPT_LGMRES_CYCLES\n
+Loose GMRES, as NPT_LGMRES, with cyclic dependency convergence.\n\n
+
 Example:
 \code
 chiLBSGroupsetSetIterativeMethod(phys1,cur_gs,NPT_CLASSICRICHARDSON)
@@ -755,6 +771,24 @@ int chiLBSGroupsetSetIterativeMethod(lua_State *L)
     groupset->allow_cycles = true;
     groupset->iterative_method = NPT_GMRES;
   }
+  else if (iter_method == NPT_FGMRES)
+  {
+    groupset->iterative_method = NPT_FGMRES;
+  }
+  else if (iter_method == NPT_FGMRES_CYCLES)
+  {
+    groupset->allow_cycles = true;
+    groupset->iterative_method = NPT_FGMRES;
+  }
+  else if (iter_method == NPT_LGMRES)
+  {
+    groupset->iterative_method = NPT_LGMRES;
+  }
+  else if (iter_method == NPT_LGMRES_CYCLES)
+  {
+    groupset->allow_cycles = true;
+    groupset->iterative_method = NPT_LGMRES;
+  }
   else
   {
     chi_log.Log(LOG_0ERROR)
@@ -1118,6 +1152,90 @@ int chiLBSGroupsetSetEnableSweepLog(lua_State *L)
   return 0;
 }
 
+//###################################################################
+/**Enables or disables single precision storage and communication of
+the angular flux on cell interfaces (FLUDS and sweep messages). The cell
+solves and the flux moments remain in double precision. Delayed angular
+fluxes of cyclic dependencies are always kept in double precision.
+\param SolverIndex int Handle to the solver for which the group
+is to be created.
+
+\param GroupsetIndex int Index to the groupset to which this function should
+                         apply
+\param flag bool Flag indicating whether to use single precision psi.
+                Default false.
+
+##_
+
+Example:
+\code
+chiLBSGroupsetSetSinglePrecisionPsi(phys1,cur_gs,true)
+\endcode
+
+\ingroup LuaLBSGroupsets
+*/
+int chiLBSGroupsetSetSinglePrecisionPsi(lua_State *L)
+{
+  //============================================= Get arguments
+  int num_args = lua_gettop(L);
+  if (num_args != 3)
+    LuaPostArgAmountError("chiLBSGroupsetSetSinglePrecisionPsi",3,num_args);
+
+  LuaCheckNilValue("chiLBSGroupsetSetSinglePrecisionPsi",L,1);
+  LuaCheckNilValue("chiLBSGroupsetSetSinglePrecisionPsi",L,2);
+  LuaCheckNilValue("chiLBSGroupsetSetSinglePrecisionPsi",L,3);
+  int solver_index = lua_tonumber(L,1);
+  int grpset_index = lua_tonumber(L,2);
+  bool single_flag = lua_toboolean(L,3);
+
+  //============================================= Get pointer to solver
+  chi_physics::Solver* psolver;
+  LinearBoltzman::Solver* solver;
+  try{
+    psolver = chi_physics_handler.solver_stack.at(solver_index);
+
+    if (typeid(*psolver) == typeid(LinearBoltzman::Solver))
+    {
+      solver = (LinearBoltzman::Solver*)(psolver);
+    }
+    else
+    {
+      chi_log.Log(LOG_ALLERROR)
+        << "Incorrect solver-type "
+        << "in call to chiLBSGroupsetSetSinglePrecisionPsi";
+      exit(EXIT_FAILURE);
+    }
+  }
+  catch(const std::out_of_range& o)
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "Invalid handle to solver "
+      << "in call to chiLBSGroupsetSetSinglePrecisionPsi";
+    exit(EXIT_FAILURE);
+  }
+
+  //============================================= Obtain pointer to groupset
+  LBSGroupset* groupset;
+  try{
+    groupset = solver->group_sets.at(grpset_index);
+  }
+  catch (const std::out_of_range& o)
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "Invalid handle to groupset "
+      << "in call to chiLBSGroupsetSetSinglePrecisionPsi";
+    exit(EXIT_FAILURE);
+  }
+
+  groupset->single_precision_psi = single_flag;
+
+  chi_log.Log(LOG_0)
+    << "Groupset " << grpset_index << " flag for single precision psi "
+    << "set to " << single_flag;
+
+  return 0;
+}
+
 //###################################################################
 /**Sets the Within-Group Diffusion Synthetic Acceleration parameters
  * for this groupset. If this call is being made then it is assumed
@@ -1337,3 +1455,204 @@ int chiLBSGroupsetSetTGDSA(lua_State *L)
 
   return 0;
 }
+
+//###################################################################
+/**Sets whether WGDSA and TGDSA are applied as a right preconditioner
+(PETSc PCSHELL) of the GMRES solve, instead of being part of the
+operator. The Krylov method then works on the unaccelerated transport
+operator. NPT_FGMRES always applies DSA as preconditioner.
+\param SolverIndex int Handle to the solver for which the group
+is to be created.
+
+\param GroupsetIndex int Index to the groupset to which this function should
+                         apply
+\param flag bool Flag indicating whether DSA is used as preconditioner.
+                Default false.
+
+##_
+
+Example:
+\code
+chiLBSGroupsetSetDSAPreconditioner(phys1,cur_gs,true)
+\endcode
+
+\ingroup LuaLBSGroupsets
+*/
+int chiLBSGroupsetSetDSAPreconditioner(lua_State *L)
+{
+  //============================================= Get arguments
+  int num_args = lua_gettop(L);
+  if (num_args != 3)
+    LuaPostArgAmountError("chiLBSGroupsetSetDSAPreconditioner",3,num_args);
+
+  LuaCheckNilValue("chiLBSGroupsetSetDSAPreconditioner",L,1);
+  LuaCheckNilValue("chiLBSGroupsetSetDSAPreconditioner",L,2);
+  LuaCheckNilValue("chiLBSGroupsetSetDSAPreconditioner",L,3);
+  int solver_index = lua_tonumber(L,1);
+  int grpset_index = lua_tonumber(L,2);
+  bool pc_flag     = lua_toboolean(L,3);
+
+  //============================================= Get pointer to solver
+  chi_physics::Solver* psolver;
+  LinearBoltzman::Solver* solver;
+  try{
+    psolver = chi_physics_handler.solver_stack.at(solver_index);
+
+    if (typeid(*psolver) == typeid(LinearBoltzman::Solver))
+    {
+      solver = (LinearBoltzman::Solver*)(psolver);
+    }
+    else
+    {
+      chi_log.Log(LOG_ALLERROR)
+        << "Incorrect solver-type "
+        << "in call to chiLBSGroupsetSetDSAPreconditioner";
+      exit(EXIT_FAILURE);
+    }
+  }
+  catch(const std::out_of_range& o)
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "Invalid handle to solver "
+      << "in call to chiLBSGroupsetSetDSAPreconditioner";
+    exit(EXIT_FAILURE);
+  }
+
+  //============================================= Obtain pointer to groupset
+  LBSGroupset* groupset;
+  try{
+    groupset = solver->group_sets.at(grpset_index);
+  }
+  catch (const std::out_of_range& o)
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "Invalid handle to groupset "
+      << "in call to chiLBSGroupsetSetDSAPreconditioner";
+    exit(EXIT_FAILURE);
+  }
+
+  groupset->dsa_as_preconditioner = pc_flag;
+
+  chi_log.Log(LOG_0)
+    << "Groupset " << grpset_index << " flag for applying DSA as "
+    << "preconditioner set to " << pc_flag;
+
+  return 0;
+}
+
+//###################################################################
+/**Sets whether the Krylov solver of the groupset (KSP, shell matrix
+and vectors) is kept alive across executions of the solver. Previous
+solutions are then also stored and the initial guess of a new solve is
+the combination of them that minimizes the residual.
+
+Reuse adds up to three operator applications, i.e. sweeps including any
+DSA solves, to every solve: one to store the solution and two to compare
+the residual of the projected initial guess with that of phi_old. The
+phi_old residual is skipped when phi_old is zero, and nothing is
+compared before solutions are stored.
+
+The kept solver holds PETSc objects and is not released automatically.
+Calling this function with flag false releases it, this must be done
+before the end of the input when reuse was enabled.
+\param SolverIndex int Handle to the solver for which the group
+is to be created.
+
+\param GroupsetIndex int Index to the groupset to which this function should
+                         apply
+\param flag bool Flag indicating whether the Krylov solver is reused.
+                Default false.
+\param NumGuessVectors int (Optional) Maximum number of previous solutions
+                          stored for the initial guess. Zero disables
+                          the stored solutions. Default 4.
+
+##_
+
+Example:
+\code
+chiLBSGroupsetSetKrylovReuse(phys1,cur_gs,true)
+chiLBSGroupsetSetKrylovReuse(phys1,cur_gs,true,8)
+--... executions
+chiLBSGroupsetSetKrylovReuse(phys1,cur_gs,false)
+\endcode
+
+\ingroup LuaLBSGroupsets
+*/
+int chiLBSGroupsetSetKrylovReuse(lua_State *L)
+{
+  //============================================= Get arguments
+  int num_args = lua_gettop(L);
+  if ((num_args != 3) and (num_args != 4))
+    LuaPostArgAmountError("chiLBSGroupsetSetKrylovReuse",3,num_args);
+
+  LuaCheckNilValue("chiLBSGroupsetSetKrylovReuse",L,1);
+  LuaCheckNilValue("chiLBSGroupsetSetKrylovReuse",L,2);
+  LuaCheckNilValue("chiLBSGroupsetSetKrylovReuse",L,3);
+  int solver_index = lua_tonumber(L,1);
+  int grpset_index = lua_tonumber(L,2);
+  bool reuse_flag  = lua_toboolean(L,3);
+
+  //============================================= Get pointer to solver
+  chi_physics::Solver* psolver;
+  LinearBoltzman::Solver* solver;
+  try{
+    psolver = chi_physics_handler.solver_stack.at(solver_index);
+
+    if (typeid(*psolver) == typeid(LinearBoltzman::Solver))
+    {
+      solver = (LinearBoltzman::Solver*)(psolver);
+    }
+    else
+    {
+      chi_log.Log(LOG_ALLERROR)
+        << "Incorrect solver-type "
+        << "in call to chiLBSGroupsetSetKrylovReuse";
+      exit(EXIT_FAILURE);
+    }
+  }
+  catch(const std::out_of_range& o)
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "Invalid handle to solver "
+      << "in call to chiLBSGroupsetSetKrylovReuse";
+    exit(EXIT_FAILURE);
+  }
+
+  //============================================= Obtain pointer to groupset
+  LBSGroupset* groupset;
+  try{
+    groupset = solver->group_sets.at(grpset_index);
+  }
+  catch (const std::out_of_range& o)
+  {
+    chi_log.Log(LOG_ALLERROR)
+      << "Invalid handle to groupset "
+      << "in call to chiLBSGroupsetSetKrylovReuse";
+    exit(EXIT_FAILURE);
+  }
+
+  groupset->krylov_reuse = reuse_flag;
+  if (not reuse_flag)
+    groupset->DestroyKrylovState();
+
+  if (num_args == 4)
+  {
+    LuaCheckNilValue("chiLBSGroupsetSetKrylovReuse",L,4);
+    int num_guess_vectors = lua_tonumber(L,4);
+    if (num_guess_vectors < 0)
+    {
+      chi_log.Log(LOG_ALLERROR)
+        << "Invalid number of guess vectors "
+        << "in call to chiLBSGroupsetSetKrylovReuse. Must be >= 0.";
+      exit(EXIT_FAILURE);
+    }
+    groupset->krylov_num_guess_vectors = num_guess_vectors;
+  }
+
+  chi_log.Log(LOG_0)
+    << "Groupset " << grpset_index << " flag for reusing the Krylov "
+    << "solver set to " << reuse_flag << " with "
+    << groupset->krylov_num_guess_vectors << " guess vectors";
+
+  return 0;
+}
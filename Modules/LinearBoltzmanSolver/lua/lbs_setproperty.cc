@@ -32,6 +32,21 @@ extern ChiMath    chi_math_handler;
 
 #define WRITE_RESTART_DATA 7
 
+#define SWEEP_NUM_THREADS 8
+
+#define SWEEP_LEVEL_THREADS 9
+
+#define SWEEP_AGGREGATE_MESSAGES 10
+
+#define SWEEP_EVENT_DRIVEN 11
+
+#define SWEEP_SCHEDULER 12
+  #define SCHEDULER_FIFO             1
+  #define SCHEDULER_DEPTH_OF_GRAPH   2
+  #define SCHEDULER_BOTTOM_LEVEL     3
+  #define SCHEDULER_MOST_SUCCESSORS  4
+  #define SCHEDULER_EAGER_THEN_DEPTH 5
+
 #include <chi_log.h>
 
 extern ChiLog chi_log;
@@ -88,6 +103,35 @@ WRITE_RESTART_DATA\n
 chiLBSSetProperty(phys1,WRITE_RESTART_DATA,"YRestart1","restart",1)
 \endcode
 
+SWEEP_NUM_THREADS\n
+ Number of threads used to execute ready angle sets concurrently on each
+ location. The thread calling the solver does all the communication while
+ the sweep chunks execute on the worker threads. Expects to be followed by an
+ integer >= 1. Default 1.\n\n
+
+SWEEP_LEVEL_THREADS\n
+ Number of threads used to sweep the cells within one angle set. When
+ greater than 1 the local sweep ordering keeps its level structure (cells
+ of equal graph depth) and the cells of each level are swept concurrently.
+ Useful when few angle sets are in flight, e.g. with single angle
+ aggregation. Expects to be followed by an integer >= 1. Default 1.\n\n
+
+SWEEP_AGGREGATE_MESSAGES\n
+ Flag. When true the outgoing psi of all the angle sets that complete
+ together is sent as a single message per downstream location instead of
+ one set of messages per angle set. Reduces the message count when many
+ small angle sets are used. Expects to be followed by a boolean.
+ Default false.\n\n
+
+SWEEP_EVENT_DRIVEN\n
+ Flag. When true the sweep scheduler blocks on the outstanding MPI
+ requests whenever no angle set is ready, instead of continuously polling
+ all angle sets. Expects to be followed by a boolean. Default false.\n\n
+
+SWEEP_SCHEDULER\n
+ Sweep scheduling algorithm. Expects to be followed by one of the
+ scheduling algorithms below. Default SCHEDULER_DEPTH_OF_GRAPH.\n\n
+
 ###Discretization methods
  PWLD2D = Piecewise Linear Finite Element 2D.\n
  PWLD3D = Piecewise Linear Finite Element 3D.
@@ -96,6 +140,17 @@ chiLBSSetProperty(phys1,WRITE_RESTART_DATA,"YRestart1","restart",1)
  SERIAL = No multi-processing.\n
  FROM_SURFACE = Same partitioning as used on Surface mesh.
 
+###Scheduling algorithms
+ SCHEDULER_FIFO = Angle set groups in order, one angle set at a time.\n
+ SCHEDULER_DEPTH_OF_GRAPH = Ready angle sets by depth of the location in
+ the global sweep graph.\n
+ SCHEDULER_BOTTOM_LEVEL = Ready angle sets by the heaviest remaining
+ downstream path (b-level), weighted by local cell counts.\n
+ SCHEDULER_MOST_SUCCESSORS = Ready angle sets by number of dependent
+ locations.\n
+ SCHEDULER_EAGER_THEN_DEPTH = Ready angle sets that feed other locations
+ first, then by depth of graph.
+
 ###BoundaryIdentify
 This value follows the argument BOUNDARY_CONDITION and identifies which
 boundary is under consideration. Right now only boundaries aligned with
@@ -329,6 +384,75 @@ int chiLBSSetProperty(lua_State *L)
       solver->options.sweep_eager_limit = limit;
     }
   }
+  else if (property == SWEEP_NUM_THREADS)
+  {
+    if (numArgs!=3)
+      LuaPostArgAmountError("chiLBSSetProperty:SWEEP_NUM_THREADS",
+                            3,numArgs);
+
+    int num_threads = lua_tonumber(L,3);
+    if (num_threads<1)
+    {
+      chi_log.Log(LOG_0ERROR)
+        << "Invalid number of threads in call to "
+        << "chiLBSSetProperty:SWEEP_NUM_THREADS. "
+           "Value must be >= 1.";
+      exit(EXIT_FAILURE);
+    }
+
+    solver->options.sweep_num_threads = num_threads;
+  }
+  else if (property == SWEEP_LEVEL_THREADS)
+  {
+    if (numArgs!=3)
+      LuaPostArgAmountError("chiLBSSetProperty:SWEEP_LEVEL_THREADS",
+                            3,numArgs);
+
+    int num_threads = lua_tonumber(L,3);
+    if (num_threads<1)
+    {
+      chi_log.Log(LOG_0ERROR)
+        << "Invalid number of threads in call to "
+        << "chiLBSSetProperty:SWEEP_LEVEL_THREADS. "
+           "Value must be >= 1.";
+      exit(EXIT_FAILURE);
+    }
+
+    solver->options.sweep_level_threads = num_threads;
+  }
+  else if (property == SWEEP_AGGREGATE_MESSAGES)
+  {
+    if (numArgs!=3)
+      LuaPostArgAmountError("chiLBSSetProperty:SWEEP_AGGREGATE_MESSAGES",
+                            3,numArgs);
+
+    solver->options.sweep_aggregate_messages = lua_toboolean(L,3);
+  }
+  else if (property == SWEEP_EVENT_DRIVEN)
+  {
+    if (numArgs!=3)
+      LuaPostArgAmountError("chiLBSSetProperty:SWEEP_EVENT_DRIVEN",
+                            3,numArgs);
+
+    solver->options.sweep_event_driven = lua_toboolean(L,3);
+  }
+  else if (property == SWEEP_SCHEDULER)
+  {
+    if (numArgs!=3)
+      LuaPostArgAmountError("chiLBSSetProperty:SWEEP_SCHEDULER",
+                            3,numArgs);
+
+    int scheduler = lua_tonumber(L,3);
+    if (scheduler < SCHEDULER_FIFO or scheduler > SCHEDULER_EAGER_THEN_DEPTH)
+    {
+      chi_log.Log(LOG_0ERROR)
+        << "Invalid scheduling algorithm in call to "
+        << "chiLBSSetProperty:SWEEP_SCHEDULER.";
+      exit(EXIT_FAILURE);
+    }
+
+    solver->options.sweep_scheduler = scheduler;
+  }
   else if (property == READ_RESTART_DATA)
   {
     if (numArgs >= 3)
@@ -31,6 +31,10 @@ RegisterConstant(NPT_CLASSICRICHARDSON,          1);
 RegisterConstant(NPT_CLASSICRICHARDSON_CYCLES,   2);
 RegisterConstant(NPT_GMRES,                      3);
 RegisterConstant(NPT_GMRES_CYCLES,               4);
+RegisterConstant(NPT_FGMRES,                     5);
+RegisterConstant(NPT_FGMRES_CYCLES,              6);
+RegisterConstant(NPT_LGMRES,                     7);
+RegisterConstant(NPT_LGMRES_CYCLES,              8);
 RegisterConstant(GROUPSET_TOLERANCE,   102);
 RegisterConstant(GROUPSET_MAXITERATIONS,   103);
 RegisterConstant(GROUPSET_GMRESRESTART_INTVL,   104);
@@ -46,6 +50,16 @@ RegisterConstant(SCATTERING_ORDER,   4);
 RegisterConstant(SWEEP_EAGER_LIMIT,   5);
 RegisterConstant(READ_RESTART_DATA,   6);
 RegisterConstant(WRITE_RESTART_DATA,  7);
+RegisterConstant(SWEEP_NUM_THREADS,   8);
+RegisterConstant(SWEEP_LEVEL_THREADS, 9);
+RegisterConstant(SWEEP_AGGREGATE_MESSAGES, 10);
+RegisterConstant(SWEEP_EVENT_DRIVEN,  11);
+RegisterConstant(SWEEP_SCHEDULER,     12);
+RegisterConstant(SCHEDULER_FIFO,             1);
+RegisterConstant(SCHEDULER_DEPTH_OF_GRAPH,   2);
+RegisterConstant(SCHEDULER_BOTTOM_LEVEL,     3);
+RegisterConstant(SCHEDULER_MOST_SUCCESSORS,  4);
+RegisterConstant(SCHEDULER_EAGER_THEN_DEPTH, 5);
 RegisterFunction(chiLBSInitialize)
 RegisterFunction(chiLBSExecute)
 RegisterFunction(chiLBSGetFieldFunctionList)
@@ -68,5 +82,8 @@ RegisterFunction(chiLBSGroupsetSetResidualTolerance)
 RegisterFunction(chiLBSGroupsetSetMaxIterations)
 RegisterFunction(chiLBSGroupsetSetGMRESRestartIntvl)
 RegisterFunction(chiLBSGroupsetSetEnableSweepLog)
+RegisterFunction(chiLBSGroupsetSetSinglePrecisionPsi)
 RegisterFunction(chiLBSGroupsetSetWGDSA)
-RegisterFunction(chiLBSGroupsetSetTGDSA)
\ No newline at end of file
+RegisterFunction(chiLBSGroupsetSetTGDSA)
+RegisterFunction(chiLBSGroupsetSetDSAPreconditioner)
+RegisterFunction(chiLBSGroupsetSetKrylovReuse)
\ No newline at end of file